@@ -1,6 +1,6 @@
 #include "gb.h"
 
-static uint32_t noise_seed = 0;
+static GB_LOCAL uint32_t noise_seed = 0;
 
 /* This is not a complete emulation of the camera chip. Only the features used by the Game Boy Camera ROMs are supported.
     We also do not emulate the timing of the real cart when a webcam is used, as it might be actually faster than the webcam. */
@@ -1,12 +1,23 @@
 #include "random.h"
 #include <time.h>
 
-static uint64_t seed;
-static bool enabled = true;
+static GB_LOCAL uint64_t seed;
+static GB_LOCAL bool enabled = true;
+static GB_LOCAL bool seeded;
+
+static void init_thread_seed(void)
+{
+    seeded = true;
+    seed = time(NULL);
+    for (unsigned i = 64; i--;) {
+        GB_random();
+    }
+}
 
 uint8_t GB_random(void)
 {
     if (!enabled) return 0;
+    if (!seeded) init_thread_seed();
     
     seed *= 0x27BB2EE687B0B0FDL;
     seed += 0xB504F32D;
@@ -21,6 +32,7 @@ uint32_t GB_random32(void)
 
 void GB_random_seed(uint64_t new_seed)
 {
+    seeded = true;
     seed = new_seed;
 }
 
@@ -31,8 +43,5 @@ void GB_random_set_enabled(bool enable)
 
 static void __attribute__((constructor)) init_seed(void)
 {
-    seed = time(NULL);
-    for (unsigned i = 64; i--;) {
-        GB_random();
-    }
+    init_thread_seed();
 }
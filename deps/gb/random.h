@@ -3,6 +3,17 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// One generator per thread when the emulator is built with multiple instances
+#if defined(BSNES_INSTANCES)
+    #if defined(_MSC_VER)
+        #define GB_LOCAL __declspec(thread)
+    #else
+        #define GB_LOCAL __thread
+    #endif
+#else
+    #define GB_LOCAL
+#endif
+
 uint8_t GB_random(void);
 uint32_t GB_random32(void);
 void GB_random_seed(uint64_t seed);
@@ -143,9 +143,20 @@ typedef struct _state_t {
     int16_t extra[SPC_EXTRA_SIZE];
 } state_t;
 
-static state_t m;
-
-static int interp_algo = 0;
+// One DSP per thread when the emulator is built with multiple instances
+#if defined(BSNES_INSTANCES)
+    #if defined(_MSC_VER)
+        #define SPC_LOCAL __declspec(thread)
+    #else
+        #define SPC_LOCAL __thread
+    #endif
+#else
+    #define SPC_LOCAL
+#endif
+
+static SPC_LOCAL state_t m;
+
+static SPC_LOCAL int interp_algo = 0;
 
 // CPU Byte Order Utilities
 
@@ -158,9 +158,9 @@ static jg_setting_t settings_bsnes[] = {
       0, 0, 1, JG_SETTING_RESTART
     },
     { "rsqual", "Resampler Quality",
-      "0 = Fastest, 1 = Medium, 2 = Best",
+      "0 = Fastest, 1 = Medium, 2 = Best, 3 = Polyphase",
       "Quality level for the internal resampler",
-      0, 0, 2, 1
+      0, 0, 3, 1
     },
     { "spc_interp", "SPC Interpolation Algorithm",
       "0 = Gaussian, 1 = Sinc",
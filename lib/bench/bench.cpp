@@ -0,0 +1,257 @@
+/*
+Copyright (c) 2024 Rupert Carmichael
+
+Permission to use, copy, modify, and/or distribute this software for any
+purpose with or without fee is hereby granted.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+
+#include <bsnes.hpp>
+
+#define SCREEN_WIDTH 256
+#define SCREEN_HEIGHT 240
+#define SAMPLERATE 48000
+#define FRAMERATE 60 // Approximately 60Hz
+
+// Video and audio buffers, written by the emulator but never presented
+static uint32_t vbuf[SCREEN_WIDTH * SCREEN_HEIGHT * 4];
+static float abuf[(SAMPLERATE / FRAMERATE) << 2];
+
+// Dimensions of the last frame, for the framebuffer hash
+static unsigned vw = 0;
+static unsigned vh = 0;
+static unsigned vpitch = 0;
+
+// Game data
+static std::vector<uint8_t> game;
+static std::string gamepath = "";
+
+// Data path for BML assets
+static std::string datapath = DATADIR;
+
+// Recorded input: one pair of gamepad states per frame
+static std::vector<unsigned> inputlog[2];
+static size_t frame = 0;
+
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static void logCallback(void*, int level, std::string& text) {
+    if (level)
+        fprintf(stderr, "%s\n", text.c_str());
+}
+
+static bool fileOpenS(void*, std::string name, std::stringstream& ss) {
+    std::string path = datapath + "/" + name;
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+    if (!stream.is_open()) {
+        fprintf(stderr, "Failed to load file: %s\n", path.c_str());
+        return false;
+    }
+
+    ss << stream.rdbuf();
+    stream.close();
+
+    return true;
+}
+
+// Saves are neither loaded nor written, so every run starts from power on
+static bool fileOpenV(void*, std::string, std::vector<uint8_t>&) {
+    return false;
+}
+
+static bool fileOpenMsu(void*, std::string, std::istream**) {
+    return false;
+}
+
+static void fileWrite(void*, std::string, const uint8_t*, unsigned) {
+}
+
+static bool loadRom(void*, unsigned id) {
+    if (id == Bsnes::GameType::SuperFamicom) {
+        if (game.size() < 0x8000) return false;
+        Bsnes::setRomSuperFamicom(game, gamepath);
+        return true;
+    }
+    return false;
+}
+
+static void videoFrame(const void*, unsigned w, unsigned h, unsigned p) {
+    vw = w;
+    vh = h;
+    vpitch = p;
+}
+
+static void audioFrame(const void*, size_t) {
+}
+
+// Gamepad state for the current frame, released once the log runs out
+static int pollGamepad(const void*, unsigned port, unsigned) {
+    if (port > 1 || frame >= inputlog[port].size())
+        return 0;
+    return inputlog[port][frame];
+}
+
+/* Input logs are text, one line per frame holding the hexadecimal gamepad
+   states of ports 1 and 2 as Bsnes::Input::Gamepad bits. Blank lines and
+   lines starting with '#' are skipped.
+*/
+static bool loadInputLog(const char *path) {
+    std::ifstream stream(path);
+    if (!stream.is_open())
+        return false;
+
+    for (std::string line; std::getline(stream, line);) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream ss(line);
+        unsigned p1 = 0, p2 = 0;
+        ss >> std::hex >> p1 >> p2;
+        inputlog[0].push_back(p1);
+        inputlog[1].push_back(p2);
+    }
+
+    return true;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-f FRAMES] [-w FRAMES] [-i INPUT] "
+        "[-d DATADIR] [-s SEED] [FILE]\n"
+        "  -f  Frames to measure (default 600)\n"
+        "  -w  Frames to run before measuring (default 0)\n"
+        "  -i  Input log to replay\n"
+        "  -d  Directory holding the BML assets\n"
+        "  -s  Random seed for the power-on state (default 1)\n",
+        name);
+}
+
+int main (int argc, char *argv[]) {
+    unsigned frames = 600;
+    unsigned warmup = 0;
+    unsigned seed = 1;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:w:i:d:s:")) != -1) {
+        switch (opt) {
+            case 'f': frames = strtoul(optarg, nullptr, 0); break;
+            case 'w': warmup = strtoul(optarg, nullptr, 0); break;
+            case 'd': datapath = optarg; break;
+            case 's': seed = strtoul(optarg, nullptr, 0); break;
+            case 'i': {
+                if (!loadInputLog(optarg)) {
+                    fprintf(stderr, "Failed to open input log: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (optind >= argc || !frames) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Load the uncompressed game data into memory
+    std::ifstream stream(argv[optind], std::ios::in | std::ios::binary);
+    if (!stream.is_open()) {
+        fprintf(stderr, "Failed to open requested file\n");
+        return 1;
+    }
+
+    game = std::vector<uint8_t>((std::istreambuf_iterator<char>(stream)),
+        std::istreambuf_iterator<char>());
+    stream.close();
+    gamepath = argv[optind];
+
+    Bsnes::setLogCallback(nullptr, logCallback);
+    Bsnes::setOpenFileCallback(nullptr, fileOpenV);
+    Bsnes::setOpenStreamCallback(nullptr, fileOpenS);
+    Bsnes::setOpenMsuCallback(nullptr, fileOpenMsu);
+    Bsnes::setRomLoadCallback(nullptr, loadRom);
+    Bsnes::setWriteCallback(nullptr, fileWrite);
+
+    Bsnes::setAudioSpec({double(SAMPLERATE), (SAMPLERATE / FRAMERATE) << 1, 0,
+        abuf, nullptr, &audioFrame});
+    Bsnes::setVideoSpec({vbuf, nullptr, &videoFrame});
+    Bsnes::setRandomSeed(seed);
+
+    if (!Bsnes::load()) {
+        fprintf(stderr, "Failed to load ROM\n");
+        return 1;
+    }
+    Bsnes::power();
+
+    Bsnes::setInputSpec({0, Bsnes::Input::Device::Gamepad,
+        nullptr, pollGamepad});
+    Bsnes::setInputSpec({1, Bsnes::Input::Device::Gamepad,
+        nullptr, pollGamepad});
+
+    for (frame = 0; frame < warmup; ++frame)
+        Bsnes::run();
+
+    // Time each frame individually, and the run as a whole
+    std::vector<double> latency;
+    latency.reserve(frames);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < frames; ++i, ++frame) {
+        auto t = std::chrono::steady_clock::now();
+        Bsnes::run();
+        latency.push_back(std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - t).count());
+    }
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::sort(latency.begin(), latency.end());
+    auto percentile = [&](unsigned p) -> double {
+        return latency[(latency.size() - 1) * p / 100];
+    };
+
+    // Hash the final frame and the state for comparison between builds
+    uint64_t vhash = 14695981039346656037ull;
+    for (unsigned y = 0; y < vh; ++y)
+        vhash = fnv1a(vhash, vbuf + y * vpitch, vw * sizeof(uint32_t));
+
+    std::vector<uint8_t> state(Bsnes::serializeSize());
+    unsigned size = Bsnes::serialize(state.data());
+    uint64_t shash = fnv1a(14695981039346656037ull, state.data(), size);
+
+    printf("frames   %u\n", frames);
+    printf("time     %.3f s\n", seconds);
+    printf("fps      %.2f\n", frames / seconds);
+    printf("latency  p50 %.3f p95 %.3f p99 %.3f max %.3f ms\n",
+        percentile(50), percentile(95), percentile(99), latency.back());
+    printf("video    %016llx (%ux%u)\n", (unsigned long long)vhash, vw, vh);
+    printf("state    %016llx (%u bytes)\n", (unsigned long long)shash, size);
+
+    Bsnes::unload();
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+/*
+Copyright (c) 2024 Rupert Carmichael
+
+Permission to use, copy, modify, and/or distribute this software for any
+purpose with or without fee is hereby granted.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+
+#include <bsnes.hpp>
+
+#include "memory.hpp"
+
+#define SAMPLERATE 48000
+#define FRAMERATE 60 // Approximately 60Hz
+
+// Video and audio buffers, written by the emulator but never presented
+static uint32_t vbuf[256 * 240 * 4];
+static float abuf[(SAMPLERATE / FRAMERATE) << 2];
+
+// Game data, generated rather than loaded so that every build sees the same
+static std::vector<uint8_t> game;
+static std::string gamepath = "busbench.sfc";
+
+// Data path for BML assets
+static std::string datapath = DATADIR;
+
+// Keeps the compiler from discarding the reads being timed
+static volatile unsigned sink = 0;
+
+static void logCallback(void*, int level, std::string& text) {
+    if (level)
+        fprintf(stderr, "%s\n", text.c_str());
+}
+
+static bool fileOpenS(void*, std::string name, std::stringstream& ss) {
+    std::string path = datapath + "/" + name;
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+    if (!stream.is_open()) {
+        fprintf(stderr, "Failed to load file: %s\n", path.c_str());
+        return false;
+    }
+
+    ss << stream.rdbuf();
+    stream.close();
+
+    return true;
+}
+
+static bool fileOpenV(void*, std::string, std::vector<uint8_t>&) {
+    return false;
+}
+
+static bool fileOpenMsu(void*, std::string, std::istream**) {
+    return false;
+}
+
+static void fileWrite(void*, std::string, const uint8_t*, unsigned) {
+}
+
+static bool loadRom(void*, unsigned id) {
+    if (id == Bsnes::GameType::SuperFamicom) {
+        Bsnes::setRomSuperFamicom(game, gamepath);
+        return true;
+    }
+    return false;
+}
+
+static void videoFrame(const void*, unsigned, unsigned, unsigned) {
+}
+
+static void audioFrame(const void*, size_t) {
+}
+
+static int pollGamepad(const void*, unsigned, unsigned) {
+    return 0;
+}
+
+/* A 1MB image with a LoROM or SA-1 header and 8KB of cartridge RAM. The CPU
+   only spins at the reset vector, so the bus is left to the benchmark.
+*/
+static void makeImage(bool sa1) {
+    game.assign(0x100000, 0);
+    for (size_t i = 0; i < game.size(); ++i)
+        game[i] = i * 7;
+
+    const uint8_t code[] = { 0x78, 0x18, 0xfb, 0x80, 0xfe }; // sei clc xce bra
+    for (size_t bank = 0; bank < game.size(); bank += 0x8000)
+        std::copy(code, code + sizeof(code), game.begin() + bank);
+
+    const char title[] = "BUS BENCH            ";
+    std::copy(title, title + 21, game.begin() + 0x7fc0);
+    game[0x7fd5] = sa1 ? 0x23 : 0x20; // map mode
+    game[0x7fd6] = sa1 ? 0x35 : 0x02; // cartridge type: RAM and battery
+    game[0x7fd7] = 0x0a; // ROM size
+    game[0x7fd8] = 0x03; // RAM size
+    game[0x7fd9] = 0x01;
+    game[0x7fda] = 0x33;
+    for (unsigned vector = 0x7fe4; vector < 0x8000; vector += 2) {
+        game[vector + 0] = 0x00;
+        game[vector + 1] = 0x80;
+    }
+
+    unsigned sum = 0;
+    game[0x7fdc] = game[0x7fdd] = game[0x7fde] = game[0x7fdf] = 0;
+    for (uint8_t byte : game)
+        sum += byte;
+    game[0x7fdc] = ~sum;
+    game[0x7fdd] = ~sum >> 8;
+    game[0x7fde] = sum;
+    game[0x7fdf] = sum >> 8;
+}
+
+static void region(const char *name, unsigned bank0, unsigned bank1,
+    unsigned lo, unsigned hi, bool write, unsigned runs) {
+    // Roughly 2^27 accesses per run
+    uint64_t span = uint64_t(bank1 - bank0 + 1) * (hi - lo + 1);
+    unsigned reps = (1u << 27) / span + 1;
+
+    auto pass = [&](unsigned count) {
+        unsigned sum = 0;
+        for (unsigned r = 0; r < count; ++r) {
+            for (unsigned b = bank0; b <= bank1; ++b) {
+                for (unsigned a = lo; a <= hi; ++a) {
+                    if (write)
+                        SuperFamicom::bus.write(b << 16 | a, a);
+                    else
+                        sum += SuperFamicom::bus.read(b << 16 | a, 0);
+                }
+            }
+        }
+        sink = sum;
+    };
+
+    /* Accesses which synchronize a coprocessor may let it catch up to the CPU
+       once, so the first pass is not timed
+    */
+    pass(1);
+
+    double best = 0.0;
+    for (unsigned i = 0; i < runs; ++i) {
+        auto t = std::chrono::steady_clock::now();
+        pass(reps);
+        double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - t).count();
+        double rate = span * reps / seconds;
+        if (rate > best)
+            best = rate;
+    }
+
+    printf("%-24s %8.1f M accesses/s\n", name, best / 1000000.0);
+}
+
+static bool power(bool sa1) {
+    makeImage(sa1);
+
+    if (!Bsnes::load()) {
+        fprintf(stderr, "Failed to load generated %s image\n",
+            sa1 ? "SA-1" : "LoROM");
+        return false;
+    }
+    Bsnes::power();
+
+    Bsnes::setInputSpec({0, Bsnes::Input::Device::Gamepad,
+        nullptr, pollGamepad});
+    Bsnes::setInputSpec({1, Bsnes::Input::Device::Gamepad,
+        nullptr, pollGamepad});
+
+    Bsnes::run();
+    return true;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-r RUNS] [-d DATADIR]\n"
+        "  -r  Timed runs per region, best is reported (default 5)\n"
+        "  -d  Directory holding the BML assets\n",
+        name);
+}
+
+int main (int argc, char *argv[]) {
+    unsigned runs = 5;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "r:d:")) != -1) {
+        switch (opt) {
+            case 'r': runs = strtoul(optarg, nullptr, 0); break;
+            case 'd': datapath = optarg; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (!runs) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    Bsnes::setLogCallback(nullptr, logCallback);
+    Bsnes::setOpenFileCallback(nullptr, fileOpenV);
+    Bsnes::setOpenStreamCallback(nullptr, fileOpenS);
+    Bsnes::setOpenMsuCallback(nullptr, fileOpenMsu);
+    Bsnes::setRomLoadCallback(nullptr, loadRom);
+    Bsnes::setWriteCallback(nullptr, fileWrite);
+
+    Bsnes::setAudioSpec({double(SAMPLERATE), (SAMPLERATE / FRAMERATE) << 1, 0,
+        abuf, nullptr, &audioFrame});
+    Bsnes::setVideoSpec({vbuf, nullptr, &videoFrame});
+
+    // Plain ROM and WRAM, which need no coprocessor
+    if (!power(false))
+        return 1;
+    printf("LoROM\n");
+    region("  ROM read 00-1f:8000", 0x00, 0x1f, 0x8000, 0xffff, false, runs);
+    region("  WRAM read 7e-7f", 0x7e, 0x7f, 0x0000, 0xffff, false, runs);
+    region("  WRAM write 7e-7f", 0x7e, 0x7f, 0x0000, 0xffff, true, runs);
+    region("  SRAM read 70:0000", 0x70, 0x70, 0x0000, 0x1fff, false, runs);
+    Bsnes::unload();
+
+    // The SA-1's ROM, BW-RAM and I-RAM go through its bus handlers
+    if (!power(true))
+        return 1;
+    printf("SA-1\n");
+    region("  ROM read 00-1f:8000", 0x00, 0x1f, 0x8000, 0xffff, false, runs);
+    region("  WRAM read 7e-7f", 0x7e, 0x7f, 0x0000, 0xffff, false, runs);
+    region("  BW-RAM read 40:0000", 0x40, 0x40, 0x0000, 0x1fff, false, runs);
+    region("  BW-RAM write 40:0000", 0x40, 0x40, 0x0000, 0x1fff, true, runs);
+    region("  I-RAM read 00:3000", 0x00, 0x00, 0x3000, 0x37ff, false, runs);
+    Bsnes::unload();
+
+    return 0;
+}
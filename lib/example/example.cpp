@@ -26,6 +26,7 @@ PERFORMANCE OF THIS SOFTWARE.
 #define SCREEN_HEIGHT 240
 #define SAMPLERATE 48000
 #define FRAMERATE 60 // Approximately 60Hz
+#define SUMMARY_INTERVAL (FRAMERATE * 10) // Frames between percentile summaries
 #define CHANNELS 2
 
 // SDL Audio
@@ -64,6 +65,10 @@ static std::string datapath = "";
 // Keep track of whether the emulator should be running or not
 static int running = 1;
 
+// Per-frame profile output, if requested, and frames written to it
+static FILE *profile = nullptr;
+static unsigned long long profileFrames = 0;
+
 static unsigned buttons[5][12] = {{0}};
 static unsigned bmap[] = {
     Bsnes::Input::Gamepad::Up, Bsnes::Input::Gamepad::Down,
@@ -254,6 +259,40 @@ static void audioFrame(const void*, size_t numsamps) {
     SDL_QueueAudio(dev, outbuf, srcdata.output_frames_gen << 2);
 }
 
+static void writeProfile(void) {
+    static std::vector<uint64_t> times;
+    Bsnes::getFrameTimes(times);
+    if (times.empty())
+        return;
+
+    if (ftell(profile) == 0) {
+        Bsnes::Stats stats = Bsnes::getStats();
+        fprintf(profile, "frame");
+        for (std::string& name : stats.threads)
+            fprintf(profile, ",%s", name.c_str());
+        fprintf(profile, ",Total\n");
+    }
+
+    fprintf(profile, "%llu", ++profileFrames);
+    for (uint64_t ns : times)
+        fprintf(profile, ",%llu", (unsigned long long)ns);
+    fprintf(profile, "\n");
+}
+
+static void printPercentiles(void) {
+    Bsnes::Stats stats = Bsnes::getStats();
+    if (stats.threads.empty())
+        return;
+
+    stats.threads.push_back("Total");
+    fprintf(stderr, "Frame times over the last %u frames (us): p50 p95 p99\n",
+        stats.window);
+    for (size_t i = 0; i < stats.threads.size(); ++i) {
+        fprintf(stderr, "  %-12s %8.1f %8.1f %8.1f\n", stats.threads[i].c_str(),
+            stats.p50[i] / 1000.0, stats.p95[i] / 1000.0, stats.p99[i] / 1000.0);
+    }
+}
+
 static int pollGamepad(const void*, unsigned port, unsigned) {
     int b = 0;
     for (int i = 0; i < 12; ++i)
@@ -263,10 +302,17 @@ static int pollGamepad(const void*, unsigned port, unsigned) {
 
 int main (int argc, char *argv[]) {
     if (argc < 2) {
-        fprintf(stderr, "Usage: ./%s [FILE]\n", argv[0]);
+        fprintf(stderr, "Usage: ./%s [FILE] [PROFILE.csv]\n", argv[0]);
         exit(1);
     }
 
+    // Per-frame timings are only collected if libbsnes has ENABLE_STATS
+    if (argc > 2) {
+        profile = fopen(argv[2], "w");
+        if (!profile)
+            fprintf(stderr, "Failed to open profile output: %s\n", argv[2]);
+    }
+
     // Find the relative path to the executable
     std::string relpath = argv[0];
     relpath = relpath.substr(0, relpath.find_last_of('/'));
@@ -406,8 +452,15 @@ int main (int argc, char *argv[]) {
             collector -= dm.refresh_rate;
         }
 
-        for (int i = 0; i < runframes; ++i)
+        for (int i = 0; i < runframes; ++i) {
             Bsnes::run();
+            if (profile) {
+                writeProfile();
+                // Percentiles copy and sort the window, so only summarize
+                if (profileFrames && profileFrames % SUMMARY_INTERVAL == 0)
+                    printPercentiles();
+            }
+        }
 
         SDL_Rect srcrect = {0, 0, rw, rh};
         SDL_RenderClear(renderer);
@@ -430,6 +483,11 @@ int main (int argc, char *argv[]) {
         }
     }
 
+    if (profile) {
+        printPercentiles();
+        fclose(profile);
+    }
+
     // Save SRAM and unload the game
     Bsnes::save();
     Bsnes::unload();
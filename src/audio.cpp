@@ -18,6 +18,7 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
 #include <cstdlib>
 #include <cstdint>
 #include <cstring>
@@ -44,9 +45,10 @@ void Audio::setSpf(unsigned spf) {
   _spf = spf;
 }
 
-// Low to High
+// Low to High, followed by the built-in polyphase resampler
 void Audio::setQuality(unsigned rsqual) {
-  _rsqual = 2 - rsqual;
+  _polyphase = rsqual > 2;
+  if (!_polyphase) _rsqual = 2 - rsqual;
 }
 
 Stream* Audio::createStream(double frequency) {
@@ -60,7 +62,7 @@ Stream::~Stream() {
     srcstate = src_delete(srcstate);
     srcstate = nullptr;
     queue_in.clear();
-    queue_out.clear();
+    ring.clear();
     free(resamp_out);
 }
 
@@ -73,8 +75,16 @@ void Stream::reset(double freq_in) {
 
   src_reset(srcstate);
   setFrequency(freq_in, audio._frequency);
-  queue_in.reserve(audio._spf << 1);
-  queue_out.reserve(audio._spf << 1);
+  fill_in = 0;
+
+  //room for a quarter second of output, and never less than a few frames
+  unsigned capacity = 1;
+  while(capacity < (unsigned)(outputFrequency / 2) || capacity < audio._spf << 2) capacity <<= 1;
+  ring.assign(capacity, 0.0f);
+  ringMask = capacity - 1;
+  ringRead = 0;
+  ringWrite = 0;
+
   resamp_out = (float*)calloc((audio._spf << 1), sizeof(float));
 }
 
@@ -86,29 +96,164 @@ void Stream::setFrequency(double freq_in, double freq_out) {
   srcdata.src_ratio = outputFrequency / inputFrequency;
   spf_in = (unsigned)(inputFrequency / ((outputFrequency / audio._spf)));
   if (spf_in & 1) --spf_in; // 2 channels means samples per frame must be even
+  if (queue_in.size() < spf_in) queue_in.resize(spf_in);
+
+  if (inputFrequency == outputFrequency) {
+    mode = Mode::Bypass;
+  } else if (audio._polyphase) {
+    mode = Mode::Polyphase;
+    buildPolyphase();
+  } else {
+    mode = Mode::Sinc;
+  }
 }
 
 void Stream::write(const int16_t samples[]) {
-  queue_in.push_back(samples[0] / 32768.0f);
-  queue_in.push_back(samples[1] / 32768.0f);
-
-  if (queue_in.size() == spf_in) {
-    srcdata.data_in = queue_in.data();
-    srcdata.data_out = resamp_out;
-    srcdata.input_frames = spf_in >> 1;
-    srcdata.output_frames = audio._spf;
-    src_process(srcstate, &srcdata);
-    queue_in.clear();
+  write(samples, 1);
+}
+
+void Stream::write(const int16_t *samples, unsigned frames) {
+  switch (mode) {
+    case Mode::Bypass: writeBypass(samples, frames); break;
+    case Mode::Polyphase: writePolyphase(samples, frames); break;
+    case Mode::Sinc: writeSinc(samples, frames); break;
+  }
+  while (audio.process());
+}
+
+void Stream::writeBypass(const int16_t *samples, unsigned frames) {
+  float out[512];
+  while (frames) {
+    unsigned count = frames < 256 ? frames : 256;
+    for (unsigned i = 0; i < count << 1; ++i) {
+      out[i] = samples[i] * (1.0f / 32768.0f);
+    }
+    push(out, count << 1);
+    samples += count << 1;
+    frames -= count;
+  }
+}
+
+void Stream::writePolyphase(const int16_t *samples, unsigned frames) {
+  const float scale = 1.0f / (32768.0f * 16384.0f);
+  float out[512];
+  unsigned count = 0;
 
-    for (int i = 0; i < srcdata.output_frames_gen << 1; ++i) {
-      queue_out.push_back(resamp_out[i]);
+  for (unsigned n = 0; n < frames; ++n) {
+    //each sample is stored twice so the newest Taps always sit contiguously
+    tap = (tap + 1) & (Taps - 1);
+    history[0][tap] = history[0][tap + Taps] = samples[n << 1];
+    history[1][tap] = history[1][tap + Taps] = samples[(n << 1) + 1];
+    const int16_t *left = &history[0][tap + 1];
+    const int16_t *right = &history[1][tap + 1];
+
+    for (; phase < period; phase += step) {
+      const int16_t *k = &kernel[(phase >> shift) * Taps];
+      int32_t l = 0, r = 0;
+      for (unsigned i = 0; i < Taps; ++i) {
+        l += left[i] * k[i];
+        r += right[i] * k[i];
+      }
+      out[count++] = l * scale;
+      out[count++] = r * scale;
+      if (count == 512) {
+        push(out, count);
+        count = 0;
+      }
     }
+    phase -= period;
+  }
 
-    audio.process();
+  push(out, count);
+}
+
+void Stream::writeSinc(const int16_t *samples, unsigned frames) {
+  for (unsigned n = 0; n < frames; ++n) {
+    queue_in[fill_in++] = samples[n << 1] * (1.0f / 32768.0f);
+    queue_in[fill_in++] = samples[(n << 1) + 1] * (1.0f / 32768.0f);
+
+    if (fill_in >= spf_in) {
+      srcdata.data_in = queue_in.data();
+      srcdata.data_out = resamp_out;
+      srcdata.input_frames = fill_in >> 1;
+      srcdata.output_frames = audio._spf;
+      src_process(srcstate, &srcdata);
+      fill_in = 0;
+
+      push(resamp_out, srcdata.output_frames_gen << 1);
+    }
   }
 }
 
-Audio audio;
+//outputs are spaced step/period input frames apart. Integral rates reduce to
+//an exact fraction with one kernel per phase; otherwise MaxPhases kernels are
+//used and the fraction below them keeps the ratio exact over time.
+void Stream::buildPolyphase() {
+  uint64_t in = (uint64_t)inputFrequency;
+  uint64_t out = (uint64_t)outputFrequency;
+  uint64_t a = in, b = out;
+  while (b) { uint64_t t = a % b; a = b; b = t; }
+
+  if (in == inputFrequency && out == outputFrequency && a && out / a <= MaxPhases) {
+    phases = out / a;
+    shift = 0;
+    period = phases;
+    step = in / a;
+  } else {
+    phases = MaxPhases;
+    shift = 20;
+    period = (uint64_t)phases << shift;
+    step = (uint64_t)(inputFrequency * period / outputFrequency + 0.5);
+    if (!step) step = 1;
+  }
+  phase = 0;
+
+  //windowed sinc, cut off below the lower of the two Nyquist frequencies
+  const double pi = 3.14159265358979323846;
+  double ratio = outputFrequency / inputFrequency;
+  double cutoff = 0.45 * (ratio < 1.0 ? ratio : 1.0);
+  kernel.resize(phases * Taps);
+
+  for (unsigned p = 0; p < phases; ++p) {
+    double taps[Taps];
+    double sum = 0.0;
+    for (unsigned i = 0; i < Taps; ++i) {
+      double x = i - Taps / 2.0 + 1.0 - (double)p / phases;
+      double y = 2.0 * cutoff * x;
+      double sinc = y == 0.0 ? 1.0 : std::sin(pi * y) / (pi * y);
+      double window = 0.42 + 0.5 * std::cos(2.0 * pi * x / Taps)
+        + 0.08 * std::cos(4.0 * pi * x / Taps);
+      sum += taps[i] = sinc * window;
+    }
+
+    //normalize to unity gain and give the rounding error to the centre tap
+    int total = 0;
+    for (unsigned i = 0; i < Taps; ++i) {
+      total += kernel[p * Taps + i] = (int16_t)std::lround(taps[i] / sum * 16384.0);
+    }
+    kernel[p * Taps + Taps / 2 - 1] += 16384 - total;
+  }
+}
+
+unsigned Stream::pending() const {
+  return ringWrite.load(std::memory_order_acquire) - ringRead.load(std::memory_order_acquire);
+}
+
+//single producer: only the emulation thread moves ringWrite. When the reader
+//falls behind, new samples are dropped rather than blocking emulation.
+void Stream::push(const float *samples, unsigned count) {
+  unsigned write = ringWrite.load(std::memory_order_relaxed);
+  unsigned read = ringRead.load(std::memory_order_acquire);
+  unsigned space = ring.size() - (write - read);
+  if (count > space) count = space;
+
+  for (unsigned i = 0; i < count; ++i) {
+    ring[(write + i) & ringMask] = samples[i];
+  }
+  ringWrite.store(write + count, std::memory_order_release);
+}
+
+SFC_LOCAL Audio audio;
 
 Audio::~Audio() {
   reset();
@@ -121,20 +266,42 @@ void Audio::reset() {
   _streams.clear();
 }
 
-void Audio::process() {
-  for (Stream*& stream : _streams) {
-      if (stream->queue_out.size() < _spf) return;
+unsigned Audio::available() const {
+  unsigned count = ~0u;
+  for (const Stream* stream : _streams) {
+    unsigned pending = stream->pending();
+    if (pending < count) count = pending;
   }
+  return _streams.empty() ? 0 : count;
+}
+
+//single consumer: only the caller of mix moves each stream's ringRead
+void Audio::mix(float *out, unsigned count) {
+  memset(out, 0, count * sizeof(float));
 
   for (Stream*& stream : _streams) {
-    for (unsigned i = 0; i < _spf; ++i) {
-      buffer[i] += stream->queue_out[i];
+    unsigned read = stream->ringRead.load(std::memory_order_relaxed);
+    for (unsigned i = 0; i < count; ++i) {
+      out[i] += stream->ring[(read + i) & stream->ringMask];
     }
-    stream->queue_out.erase(stream->queue_out.begin(), stream->queue_out.begin() + _spf);
+    stream->ringRead.store(read + count, std::memory_order_release);
   }
+}
 
+//without a callback, samples stay queued until the host pulls them
+bool Audio::process() {
+  if (!audioFrame || available() < _spf) return false;
+  mix(buffer, _spf);
   audioFrame(udata, _spf);
-  memset(&buffer[0], 0.0, _spf * sizeof(float));
+  return true;
+}
+
+unsigned Audio::read(float *out, unsigned count) {
+  unsigned pending = available();
+  if (count > pending) count = pending;
+  count &= ~1u; // keep channels interleaved
+  mix(out, count);
+  return count;
 }
 
 }
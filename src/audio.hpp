@@ -20,11 +20,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
 #include <samplerate.h>
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct Interface;
@@ -40,10 +43,13 @@ struct Audio {
   void setCallback(void*, void (*)(const void*, std::size_t));
   void setSpf(unsigned);
   void setQuality(unsigned);
+  unsigned read(float*, unsigned);
 
 private:
-  void (*audioFrame)(const void*, std::size_t);
-  void process();
+  void (*audioFrame)(const void*, std::size_t) = nullptr;
+  unsigned available() const;
+  void mix(float*, unsigned);
+  bool process();
 
   void *udata = nullptr;
 
@@ -51,6 +57,7 @@ private:
 
   double _frequency = 48000.0;
   unsigned _rsqual = SRC_SINC_FASTEST;
+  bool _polyphase = false;
   unsigned _spf = 0;
   float *buffer = nullptr;
 
@@ -62,6 +69,7 @@ struct Stream {
   void reset(double);
   void setFrequency(double, double);
   void write(const int16_t samples[]);
+  void write(const int16_t*, unsigned);
 
   template<typename... P> void sample(P&&... p) {
     int16_t samples[sizeof...(P)] = {std::forward<P>(p)...};
@@ -71,15 +79,45 @@ struct Stream {
   SRC_STATE *srcstate = nullptr;
   SRC_DATA srcdata;
   std::vector<float> queue_in;
-  std::vector<float> queue_out;
   float *resamp_out;
   unsigned spf_in = 0;
+  unsigned fill_in = 0;
+
+  //resampled output, written by the emulator and drained either by the frame
+  //callback or by a host audio thread through Audio::read
+  std::vector<float> ring;
+  unsigned ringMask = 0;
+  std::atomic<unsigned> ringRead{0};
+  std::atomic<unsigned> ringWrite{0};
+
+  unsigned pending() const;
+  void push(const float*, unsigned);
 
 private:
+  enum class Mode : unsigned { Bypass, Polyphase, Sinc };
+  enum : unsigned { Taps = 16, MaxPhases = 1024 };
+
+  void writeBypass(const int16_t*, unsigned);
+  void writePolyphase(const int16_t*, unsigned);
+  void writeSinc(const int16_t*, unsigned);
+  void buildPolyphase();
+
+  Mode mode = Mode::Sinc;
   double inputFrequency;
   double outputFrequency = 48000.0;
+
+  //fixed-ratio polyphase filter: one output is produced every step/period
+  //input frames, using the Q14 kernel selected by phase >> shift
+  std::vector<int16_t> kernel;
+  unsigned phases = 1;
+  unsigned shift = 0;
+  uint64_t period = 1;
+  uint64_t step = 1;
+  uint64_t phase = 0;
+  unsigned tap = 0;
+  int16_t history[2][Taps << 1] = {};
 };
 
-extern Audio audio;
+extern SFC_LOCAL Audio audio;
 
 }
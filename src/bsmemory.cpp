@@ -29,7 +29,7 @@
 
 namespace SuperFamicom {
 
-BSMemory bsmemory;
+SFC_LOCAL BSMemory bsmemory;
 
 void BSMemory::serialize(serializer& s) {
   if(ROM) return;
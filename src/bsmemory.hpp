@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 //MaskROMs supported:
@@ -185,6 +187,6 @@ private:
   void failed();
 };
 
-extern BSMemory bsmemory;
+extern SFC_LOCAL BSMemory bsmemory;
 
 }
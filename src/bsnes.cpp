@@ -22,6 +22,13 @@
 #include <cstddef>
 #include <cstring>
 
+#if defined(BSNES_INSTANCES)
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
 #include "audio.hpp"
 #include "cartridge.hpp"
 #include "cheat.hpp"
@@ -34,41 +41,233 @@
 #include "expansion/expansion.hpp"
 #include "logger.hpp"
 #include "ppu.hpp"
+#include "rewind.hpp"
 #include "serializer.hpp"
 #include "settings.hpp"
+#include "smp.hpp"
 #include "system.hpp"
 
 #include "bsnes.hpp"
 
 namespace SuperFamicom {
-Configuration configuration;
+SFC_LOCAL Configuration configuration;
+};
+
+//reused by every run-ahead frame to avoid reallocating the state buffer
+static SFC_LOCAL serializer runAheadState;
+
+//preemptive run-ahead keeps the console ahead of real time by the run-ahead
+//frame count, assuming input does not change. The state at the start of each
+//of those frames is kept, so that when input does change the console can be
+//rolled back to the first frame the new input applies to and replayed.
+namespace {
+struct InputSource {
+  void *ptr;
+  int (*cb)(const void*, unsigned, unsigned);
+};
+
+struct InputRead {
+  const InputSource *source;
+  unsigned port;
+  unsigned id;
+  int value;
+};
+
+struct Preemptive {
+  bool active = false;
+  unsigned frames = 0;
+  unsigned long long next = 0;  //index of the next frame to run
+  std::vector<serializer> states;  //start of frame n is at n % states.size()
+  std::vector<std::vector<InputRead>> reads;  //input read during frame n, alike
 };
+}
+
+static SFC_LOCAL InputSource inputSources[2];
+static SFC_LOCAL Preemptive preemptive;
+
+static int inputPoll(const void *ptr, unsigned port, unsigned id) {
+  const InputSource *source = (const InputSource*)ptr;
+  int value = source->cb(source->ptr, port, id);
+  if (preemptive.active) {
+    preemptive.reads[(preemptive.next - 1) % preemptive.reads.size()]
+      .push_back({source, port, id, value});
+  }
+  return value;
+}
+
+// Return the first frame since real time which read input that has changed
+// since, or the next frame to run if there is none
+static unsigned long long inputChanged() {
+  for (unsigned long long n = preemptive.next - preemptive.frames;
+      n < preemptive.next; ++n) {
+    for (InputRead& read : preemptive.reads[n % preemptive.reads.size()]) {
+      if (read.source->cb(read.source->ptr, read.port, read.id) != read.value)
+        return n;
+    }
+  }
+  return preemptive.next;
+}
+
+static void preemptiveFrame() {
+  unsigned index = preemptive.next++ % preemptive.states.size();
+  SuperFamicom::system.serialize(preemptive.states[index], false); // deterministic
+  preemptive.reads[index].clear();
+  SuperFamicom::system.run();
+}
+
+//return the console to real time, for anything which must not see the
+//speculative frames
+static void preemptiveSettle() {
+  if (!preemptive.active)
+    return;
+
+  serializer& s = preemptive.states[(preemptive.next - preemptive.frames)
+    % preemptive.states.size()];
+  s.setMode(serializer::Mode::Load);
+  preemptive.active = false;
+  SuperFamicom::system.unserialize(s);
+}
+
+static void preemptiveCancel() {
+  preemptive.active = false;
+}
+
+#if defined(BSNES_INSTANCES)
+struct Bsnes::Instance {
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::pair<void (*)(void*), void*>> tasks;
+  bool busy = false;
+  bool quit = false;
+
+  // The instance thread's mixer, for hosts pulling audio from another thread
+  SuperFamicom::Audio *audio = nullptr;
+
+  void main();
+};
+
+void Bsnes::Instance::main() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    audio = &SuperFamicom::audio;
+  }
+  cv.notify_all();
+
+  while (true) {
+    std::pair<void (*)(void*), void*> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [this] { return quit || !tasks.empty(); });
+      if (tasks.empty())
+        break;
+      task = tasks.front();
+      tasks.pop_front();
+      busy = true;
+    }
+
+    task.first(task.second);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      busy = false;
+    }
+    cv.notify_all();
+  }
+
+  // The console is thread local, so release it before the thread exits
+  SuperFamicom::system.unload();
+  SuperFamicom::cpu.destroy();
+  SuperFamicom::smp.destroy();
+  SuperFamicom::ppu.destroy();
+}
+
+Bsnes::Instance* Bsnes::instanceCreate() {
+  Instance *inst = new Instance;
+  inst->thread = std::thread(&Instance::main, inst);
+  std::unique_lock<std::mutex> lock(inst->mutex);
+  inst->cv.wait(lock, [inst] { return inst->audio != nullptr; });
+  return inst;
+}
+
+void Bsnes::instanceDestroy(Instance *inst) {
+  {
+    std::lock_guard<std::mutex> lock(inst->mutex);
+    inst->quit = true;
+  }
+  inst->cv.notify_all();
+  inst->thread.join();
+  delete inst;
+}
+
+void Bsnes::instanceSubmit(Instance *inst, void (*cb)(void*), void *ptr) {
+  {
+    std::lock_guard<std::mutex> lock(inst->mutex);
+    inst->tasks.emplace_back(cb, ptr);
+  }
+  inst->cv.notify_all();
+}
+
+void Bsnes::instanceWait(Instance *inst) {
+  std::unique_lock<std::mutex> lock(inst->mutex);
+  inst->cv.wait(lock, [inst] { return inst->tasks.empty() && !inst->busy; });
+}
+
+size_t Bsnes::instanceReadAudio(Instance *inst, float *buf, size_t samples) {
+  return inst->audio->read(buf, std::min<size_t>(samples, ~0u));
+}
+#else
+Bsnes::Instance* Bsnes::instanceCreate() {
+  return nullptr;
+}
+
+void Bsnes::instanceDestroy(Instance*) {
+}
+
+void Bsnes::instanceSubmit(Instance*, void (*)(void*), void*) {
+}
+
+void Bsnes::instanceWait(Instance*) {
+}
+
+size_t Bsnes::instanceReadAudio(Instance*, float*, size_t) {
+  return 0;
+}
+#endif
 
 bool Bsnes::loaded() {
   return SuperFamicom::system.loaded();
 }
 
 bool Bsnes::load() {
+  preemptiveCancel();
+  SuperFamicom::rewinder.clear();
   return SuperFamicom::system.load();
 }
 
 void Bsnes::save() {
+  preemptiveSettle();
   SuperFamicom::system.save();
 }
 
 void Bsnes::unload() {
+  preemptiveCancel();
   SuperFamicom::system.unload();
+  SuperFamicom::rewinder.clear();
 }
 
 void Bsnes::power() {
+  preemptiveCancel();
   SuperFamicom::system.power(/* reset = */ false);
 }
 
 void Bsnes::reset() {
+  preemptiveSettle();
   SuperFamicom::system.power(/* reset = */ true);
 }
 
 void Bsnes::run() {
+  preemptiveSettle();
   SuperFamicom::system.run();
 }
 
@@ -76,17 +275,55 @@ void Bsnes::runAhead(unsigned frames) {
   if (!frames)
     return;
 
+  preemptiveSettle();
+
   SuperFamicom::system.runAhead = true;
   SuperFamicom::system.run();
-  serializer s = SuperFamicom::system.serialize(false); // deterministic
+  SuperFamicom::system.serialize(runAheadState, false); // deterministic
 
   for (unsigned i = 0; i < frames - 1; ++i)
     SuperFamicom::system.run();
 
   SuperFamicom::system.runAhead = false;
   SuperFamicom::system.run();
-  s.setMode(serializer::Mode::Load);
-  SuperFamicom::system.unserialize(s);
+  runAheadState.setMode(serializer::Mode::Load);
+  SuperFamicom::system.unserialize(runAheadState);
+}
+
+void Bsnes::runAheadPreemptive(unsigned frames) {
+  if (!frames)
+    return;
+
+  if (preemptive.active && preemptive.frames != frames)
+    preemptiveSettle();
+
+  unsigned long long target = preemptive.next;
+  if (!preemptive.active) {
+    preemptive.frames = frames;
+    preemptive.states.resize(frames + 1);
+    preemptive.reads.resize(frames + 1);
+    preemptive.next = 1;
+    target = frames + 1;
+  }
+  else {
+    // Roll back to the first frame whose input changed, if any
+    unsigned long long changed = inputChanged();
+    if (changed == preemptive.next) {
+      preemptiveFrame();
+      return;
+    }
+    serializer& s = preemptive.states[changed % preemptive.states.size()];
+    s.setMode(serializer::Mode::Load);
+    SuperFamicom::system.unserialize(s);
+    preemptive.next = changed;
+  }
+
+  preemptive.active = true;
+  SuperFamicom::system.runAhead = true;
+  while (preemptive.next < target)
+    preemptiveFrame();
+  SuperFamicom::system.runAhead = false;
+  preemptiveFrame();
 }
 
 bool Bsnes::getRtcPresent() {
@@ -94,6 +331,7 @@ bool Bsnes::getRtcPresent() {
 }
 
 std::pair<void*, unsigned> Bsnes::getMemoryRaw(unsigned type) {
+  preemptiveSettle();
   switch (type) {
     default: case Memory::CartRAM:
     case Memory::RealTimeClock:
@@ -118,17 +356,61 @@ unsigned Bsnes::serializeSize() {
 }
 
 unsigned Bsnes::serialize(uint8_t *data) {
+  preemptiveSettle();
   serializer s = SuperFamicom::system.serialize(true);
   std::memcpy(data, s.data(), s.size());
   return s.size();
 }
 
 bool Bsnes::unserialize(const uint8_t *data, unsigned size) {
+  preemptiveSettle();
   serializer s(data, size);
   return SuperFamicom::system.unserialize(s);
 }
 
+unsigned Bsnes::serializeDeltaSize() {
+  return SuperFamicom::system.serializeDeltaSize();
+}
+
+unsigned Bsnes::serializeDelta(uint8_t *data, const uint8_t *base, unsigned baseSize) {
+  preemptiveSettle();
+  return SuperFamicom::system.serializeDelta(base, baseSize, data);
+}
+
+bool Bsnes::unserializeDelta(const uint8_t *data, unsigned size, const uint8_t *base, unsigned baseSize) {
+  preemptiveSettle();
+  return SuperFamicom::system.unserializeDelta(base, baseSize, data, size);
+}
+
+void Bsnes::rewindSetSize(size_t size) {
+  SuperFamicom::rewinder.reset(size);
+}
+
+bool Bsnes::rewindPush() {
+  preemptiveSettle();
+  return SuperFamicom::rewinder.push();
+}
+
+bool Bsnes::rewindStep() {
+  preemptiveSettle();
+  return SuperFamicom::rewinder.step();
+}
+
+unsigned Bsnes::rewindFrames() {
+  return SuperFamicom::rewinder.frames();
+}
+
+size_t Bsnes::rewindMemoryUsed() {
+  return SuperFamicom::rewinder.used();
+}
+
+size_t Bsnes::rewindMemoryPerSecond() {
+  double fps = SuperFamicom::Region::PAL() ? 50.007 : 60.0988;
+  return SuperFamicom::rewinder.perFrame() * fps;
+}
+
 void Bsnes::cheatsClear() {
+  preemptiveSettle();
   if (!SuperFamicom::cartridge.has.ICD) {
     SuperFamicom::Memory::GlobalWriteEnable = true;
     for (SuperFamicom::Cheat::Code& chtcode : SuperFamicom::cheats.codes) {
@@ -141,6 +423,7 @@ void Bsnes::cheatsClear() {
 }
 
 void Bsnes::cheatsSetCheat(std::string code) {
+  preemptiveSettle();
   if (!(SuperFamicom::cartridge.has.ICD ? CheatDecoder::gb(code) : CheatDecoder::snes(code))) {
     logger.log(Logger::WRN, std::string("Failed to decode cheat: ") + code + "\n");
     return;
@@ -166,6 +449,80 @@ unsigned Bsnes::getRegion() {
   return SuperFamicom::cartridge.region() == "PAL" ? Region::PAL : Region::NTSC;
 }
 
+double Bsnes::getAudioFrequency() {
+  return SuperFamicom::system.apuFrequency() / 768.0;
+}
+
+Bsnes::Stats Bsnes::getStats() {
+  Stats stats{};
+#if defined(BSNES_STATS)
+  const SuperFamicom::Statistics& source = SuperFamicom::scheduler.stats;
+  using SuperFamicom::Statistics;
+
+  // Registered threads followed by the shared Other slot
+  std::vector<unsigned> index;
+  for (unsigned n = 0; n < source.count; ++n)
+    index.push_back(n);
+  index.push_back(Statistics::Other);
+
+  for (unsigned n : index) {
+    stats.threads.push_back(source.entries[n].name);
+    stats.slices.push_back(source.entries[n].slices);
+    stats.clocks.push_back(source.clocks(n));
+    for (unsigned m : index)
+      stats.switches.push_back(source.switches[n][m]);
+  }
+  stats.histogram.assign(source.histogram, source.histogram + Statistics::Buckets);
+  stats.bucketSize = Statistics::BucketSize;
+  stats.frames = source.frames;
+  stats.runToSave = source.runToSave;
+
+  // Per-thread columns of the frame records, then the whole frame
+  index.push_back(Statistics::Threads);
+  stats.window = std::min<uint64_t>(source.frames, Statistics::Window);
+  unsigned last = (source.frames + Statistics::Window - 1) % Statistics::Window;
+  std::vector<uint32_t> column(stats.window);
+  auto percentile = [&](unsigned p) -> uint64_t {
+    return column.empty() ? 0 : column[(column.size() - 1) * p / 100];
+  };
+  for (unsigned n : index) {
+    if (n < Statistics::Threads)
+      stats.nanoseconds.push_back(source.entries[n].nanoseconds);
+    stats.frameTimes.push_back(stats.window ? source.frameTimes[last][n] : 0);
+    for (unsigned f = 0; f < stats.window; ++f)
+      column[f] = source.frameTimes[f][n];
+    std::sort(column.begin(), column.end());
+    stats.p50.push_back(percentile(50));
+    stats.p95.push_back(percentile(95));
+    stats.p99.push_back(percentile(99));
+  }
+#endif
+  return stats;
+}
+
+void Bsnes::getFrameTimes(std::vector<uint64_t>& times) {
+  times.clear();
+#if defined(BSNES_STATS)
+  const SuperFamicom::Statistics& source = SuperFamicom::scheduler.stats;
+  using SuperFamicom::Statistics;
+  if (!source.frames)
+    return;
+
+  // Same column order as getStats: registered threads, Other, whole frame
+  const uint32_t *last = source.frameTimes[(source.frames - 1) % Statistics::Window];
+  for (unsigned n = 0; n < source.count; ++n)
+    times.push_back(last[n]);
+  times.push_back(last[Statistics::Other]);
+  times.push_back(last[Statistics::Threads]);
+#endif
+}
+
+void Bsnes::resetStats() {
+#if defined(BSNES_STATS)
+  SuperFamicom::scheduler.stats.reset();
+#endif
+}
+
 void Bsnes::setAudioSpec(Audio::Spec spec) {
   SuperFamicom::audio.setFrequency(spec.freq);
   SuperFamicom::audio.setSpf(spec.spf);
@@ -174,6 +531,10 @@ void Bsnes::setAudioSpec(Audio::Spec spec) {
   SuperFamicom::audio.setCallback(spec.ptr, spec.cb);
 }
 
+size_t Bsnes::readAudio(float *buf, size_t samples) {
+  return SuperFamicom::audio.read(buf, std::min<size_t>(samples, ~0u));
+}
+
 void Bsnes::setCoprocDelayedSync(bool value) {
   SuperFamicom::configuration.coprocessor.delayedSync = value;
 }
@@ -182,10 +543,18 @@ void Bsnes::setCoprocPreferHLE(bool value) {
   SuperFamicom::configuration.coprocessor.preferHLE = value;
 }
 
+void Bsnes::setSkipRender(bool value) {
+  SuperFamicom::configuration.video.skipRender = value;
+}
+
 void Bsnes::setHotfixes(bool value) {
   SuperFamicom::configuration.hotfixes = value;
 }
 
+void Bsnes::setRandomSeed(unsigned value) {
+  SuperFamicom::configuration.seed = value;
+}
+
 void Bsnes::setDIPSwitches(uint8_t value) {
   SuperFamicom::dip.value = value;
 }
@@ -203,17 +572,22 @@ void Bsnes::setSpcInterpolation(unsigned algo) {
 }
 
 void Bsnes::setInputSpec(Input::Spec spec) {
+  preemptiveSettle();
+
+  //input is read through inputPoll so preemptive run-ahead can see it
   switch(spec.port) {
     case SuperFamicom::ID::Port::Controller1:
+      inputSources[0] = {spec.ptr, spec.cb};
       SuperFamicom::controllerPort1.connect(
         SuperFamicom::configuration.controllerPort1 = spec.device,
-        spec.ptr, spec.cb
+        &inputSources[0], inputPoll
       );
       break;
     case SuperFamicom::ID::Port::Controller2:
+      inputSources[1] = {spec.ptr, spec.cb};
       SuperFamicom::controllerPort2.connect(
         SuperFamicom::configuration.controllerPort2 = spec.device,
-        spec.ptr, spec.cb
+        &inputSources[1], inputPoll
       );
       break;
     case SuperFamicom::ID::Port::Expansion:
@@ -34,12 +34,19 @@ namespace Bsnes {
     typedef struct _Spec {
       double freq;                      /**< Output frequency (Hz) */
       unsigned spf;                     /**< Samples per frame (approx) */
-      unsigned rsqual;                  /**< Resampler quality: 0-2 for fast, medium, or best */
+      unsigned rsqual;                  /**< Resampler quality: 0-2 for fast, medium, or best, 3 for polyphase */
       float *buf;                       /**< Buffer for internally resampled and mixed audio samples */
       void *ptr;                        /**< User data passed to callback */
-      void (*cb)(const void*, size_t);  /**< Callback for audio output */
+      void (*cb)(const void*, size_t);  /**< Callback for audio output, or nullptr to pull with readAudio */
     } Spec;
 
+    namespace Resampler {
+      constexpr unsigned Fast       = 0;    /**< Sinc (fastest) */
+      constexpr unsigned Medium     = 1;    /**< Sinc (medium quality) */
+      constexpr unsigned Best       = 2;    /**< Sinc (best quality) */
+      constexpr unsigned Polyphase  = 3;    /**< Built-in fixed-ratio polyphase */
+    }
+
     namespace Interpolation {
       constexpr unsigned Gaussian   = 0;    /**< Gaussian */
       constexpr unsigned Sinc       = 1;    /**< Sinc */
@@ -122,6 +129,77 @@ namespace Bsnes {
     constexpr unsigned PAL =    1;  /**< PAL: UK, Europe, Australia */
   }
 
+  /**
+   * Scheduler Statistics - Context switch, timeslice and host time
+   * counters, only collected when built with ENABLE_STATS. Host times are
+   * in nanoseconds; frame times and percentiles hold one entry per thread
+   * followed by the whole frame
+   */
+  typedef struct _Stats {
+    std::vector<std::string> threads;   /**< Thread names, host first and Other last */
+    std::vector<uint64_t> switches;     /**< Switches from thread i to j at [i * threads.size() + j] */
+    std::vector<uint64_t> slices;       /**< Timeslices run by each thread */
+    std::vector<uint64_t> clocks;       /**< Master clocks run by each thread */
+    std::vector<uint64_t> histogram;    /**< Frames by switch count, in buckets of bucketSize */
+    unsigned bucketSize;                /**< Switches per histogram bucket */
+    uint64_t frames;                    /**< Frames counted */
+    uint64_t runToSave;                 /**< Scheduler passes spent synchronizing for saves */
+    std::vector<uint64_t> nanoseconds;  /**< Host time spent in each thread, the S-DSP counted with the SMP */
+    std::vector<uint64_t> frameTimes;   /**< Host time spent in each thread during the last frame */
+    std::vector<uint64_t> p50;          /**< Median frame times over the window */
+    std::vector<uint64_t> p95;          /**< 95th percentile frame times over the window */
+    std::vector<uint64_t> p99;          /**< 99th percentile frame times over the window */
+    unsigned window;                    /**< Frames covered by the percentiles */
+  } Stats;
+
+  /**
+   * Emulator instance: a worker thread owning an independent console. With
+   * ENABLE_INSTANCES the console is made of thread local globals, so there is
+   * exactly one console per thread and an instance is the thread that drives
+   * it; two consoles cannot share a thread. Every thread in the process
+   * reserves space for a console (about 4MB), and console code runs
+   * noticeably slower than in a build without ENABLE_INSTANCES
+   */
+  struct Instance;
+
+  /**
+   * Create an emulator instance with its own console and worker thread
+   * @return Instance handle, or nullptr if built without instance support
+   */
+  Instance* instanceCreate();
+
+  /**
+   * Destroy an emulator instance, unloading any content and joining its thread
+   * @param inst Instance handle
+   */
+  void instanceDestroy(Instance *inst);
+
+  /**
+   * Queue a task on an instance's thread, where all other functions in this
+   * namespace operate on that instance's console
+   * @param inst Instance handle
+   * @param cb Task to run on the instance's thread
+   * @param ptr User data passed to the task
+   */
+  void instanceSubmit(Instance *inst, void (*cb)(void*), void *ptr);
+
+  /**
+   * Wait until all tasks queued on an instance have completed
+   * @param inst Instance handle
+   */
+  void instanceWait(Instance *inst);
+
+  /**
+   * Read mixed audio samples queued by an instance, from any thread. Only
+   * used when the instance's audio callback is nullptr, and not concurrently
+   * with load, unload, or power on that instance
+   * @param inst Instance handle
+   * @param buf Buffer for interleaved stereo samples
+   * @param samples Maximum number of samples to read
+   * @return Number of samples read, or 0 if built without instance support
+   */
+  size_t instanceReadAudio(Instance *inst, float *buf, size_t samples);
+
   /**
    * Determine if content is loaded
    * @return Content is loaded
@@ -165,6 +243,15 @@ namespace Bsnes {
    */
   void runAhead(unsigned frames);
 
+  /**
+   * Run ahead preemptively: the emulator stays multiple frames ahead of real
+   * time and only replays them when input changes, so most frames cost a
+   * single frame of emulation. Other functions which depend on the real time
+   * state (such as serialize) roll the emulator back to it first.
+   * @param frames Number of frames to run ahead
+   */
+  void runAheadPreemptive(unsigned frames);
+
   /**
    * Determine the size of the state in bytes
    * @return Size of state in bytes
@@ -186,6 +273,72 @@ namespace Bsnes {
    */
   bool unserialize(const uint8_t *data, unsigned size);
 
+  /**
+   * Determine the largest possible size of a delta state in bytes
+   * @return Maximum size of delta state in bytes
+   */
+  unsigned serializeDeltaSize();
+
+  /**
+   * Serialize emulated system state as the changes from a base state, which
+   * is much smaller than a full state when little has changed since the base
+   * @param data Empty buffer of at least serializeDeltaSize() bytes
+   * @param base Full state previously produced by serialize()
+   * @param baseSize Size of the base state in bytes
+   * @return Size of delta state in bytes, or 0 if the base does not match
+   */
+  unsigned serializeDelta(uint8_t *data, const uint8_t *base,
+    unsigned baseSize);
+
+  /**
+   * Unserialize emulated system state from a delta state
+   * @param data Buffer containing delta state data
+   * @param size Size of buffer containing delta state data
+   * @param base Full state the delta state was produced against
+   * @param baseSize Size of the base state in bytes
+   * @return Success/fail
+   */
+  bool unserializeDelta(const uint8_t *data, unsigned size,
+    const uint8_t *base, unsigned baseSize);
+
+  /**
+   * Set the memory available for rewind history, discarding any history
+   * @param size Size of the rewind buffer in bytes, or 0 to disable rewind
+   */
+  void rewindSetSize(size_t size);
+
+  /**
+   * Add the current state to the rewind history, typically once per frame
+   * @return Success/fail
+   */
+  bool rewindPush();
+
+  /**
+   * Step back to the previous state in the rewind history
+   * @return Success/fail (fails when the history is empty)
+   */
+  bool rewindStep();
+
+  /**
+   * Determine the number of steps available in the rewind history
+   * @return Number of steps available
+   */
+  unsigned rewindFrames();
+
+  /**
+   * Determine the memory used by the rewind history, including the full
+   * state it is based on
+   * @return Memory used in bytes
+   */
+  size_t rewindMemoryUsed();
+
+  /**
+   * Determine the memory used per second of rewind history, assuming one
+   * push per frame
+   * @return Memory used per second in bytes
+   */
+  size_t rewindMemoryPerSecond();
+
   /**
    * Deactivate all cheats and clear the cheat list
    */
@@ -203,6 +356,13 @@ namespace Bsnes {
    */
   unsigned getRegion();
 
+  /**
+   * Determine the native S-DSP output frequency of the loaded game. Using it
+   * as the audio output frequency passes samples through without resampling
+   * @return Native audio frequency (Hz)
+   */
+  double getAudioFrequency();
+
   /**
    * Set emulated system's region
    * @param region Emulated system's region
@@ -222,12 +382,44 @@ namespace Bsnes {
    */
   std::pair<void*, unsigned> getMemoryRaw(unsigned type);
 
+  /**
+   * Retrieve scheduler statistics gathered since power or the last reset
+   * @return Statistics, empty if built without ENABLE_STATS
+   */
+  Stats getStats();
+
+  /**
+   * Retrieve the host time spent in each thread during the last frame,
+   * followed by the whole frame, in the order of Stats::threads. Unlike
+   * getStats, this neither copies nor sorts the rolling window, so it is
+   * cheap enough to call every frame
+   * @param times Frame times in nanoseconds, empty if no frame was recorded
+   */
+  void getFrameTimes(std::vector<uint64_t>& times);
+
+  /**
+   * Reset scheduler statistics
+   */
+  void resetStats();
+
   /**
    * Set audio specifications
    * @param spec Audio specifications
    */
   void setAudioSpec(Audio::Spec spec);
 
+  /**
+   * Read mixed audio samples queued since the last read. Only used when the
+   * audio callback is nullptr; may be called from a separate audio thread,
+   * but not concurrently with load, unload, or power. With ENABLE_INSTANCES
+   * the console belongs to the calling thread, so another thread must use
+   * instanceReadAudio instead
+   * @param buf Buffer for interleaved stereo samples
+   * @param samples Maximum number of samples to read
+   * @return Number of samples read
+   */
+  size_t readAudio(float *buf, size_t samples);
+
   /**
    * Set video specifications
    * @param spec Video specifications
@@ -252,12 +444,27 @@ namespace Bsnes {
    */
   void setCoprocPreferHLE(bool value);
 
+  /**
+   * Skip rendering video frames, for headless use where no video is needed.
+   * Emulation timing is unaffected, but no video is output, and CGRAM access
+   * during active display no longer follows the palette being rendered.
+   * @param value on/off
+   */
+  void setSkipRender(bool value);
+
   /**
    * Apply hotfixes for games released with fundamental bugs
    * @param value on/off
    */
   void setHotfixes(bool value);
 
+  /**
+   * Seed the randomized power-on state with a fixed value, making runs
+   * reproducible. Applied at the next power cycle
+   * @param value Seed, or 0 to seed from the host clock
+   */
+  void setRandomSeed(unsigned value);
+
   /**
    * Set the value of any available DIP switches
    * @param value 8 DIP switches with each bit representing one switch
@@ -158,13 +158,13 @@ static const uint8_t hitachidspStaticDataROM[3072] = {
   115,34,78,86,31,133,55,28,166,23,25,208,246,21,32,213,18,183,178,15,178,143,12,50,108,9,85,72,6,58,36,3
 };
 
-static Game game;
-static Game slotGameBoy;
-static Game slotBSMemory;
-static Game slotSufamiTurboA;
-static Game slotSufamiTurboB;
+static SFC_LOCAL Game game;
+static SFC_LOCAL Game slotGameBoy;
+static SFC_LOCAL Game slotBSMemory;
+static SFC_LOCAL Game slotSufamiTurboA;
+static SFC_LOCAL Game slotSufamiTurboB;
 
-Cartridge cartridge;
+SFC_LOCAL Cartridge cartridge;
 
 unsigned Cartridge::pathID() const { return information.pathID; }
 std::string Cartridge::region() const { return information.region; }
@@ -196,7 +196,7 @@ unsigned Cartridge::loadMap(std::string map, T& memory) {
   unsigned mask = strmask.empty() ? 0 : std::stoi(strmask, nullptr, 16);
   if(size == 0) size = memory.size();
   if(size == 0) return 0; //does this ever actually occur? - Yes! Sufami Turbo.
-  return bus.map({&T::read, &memory}, {&T::write, &memory}, addr, size, base, mask);
+  return bus.map(memory, addr, size, base, mask);
 }
 
 unsigned Cartridge::loadMap(
@@ -24,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "instance.hpp"
 #include "memory.hpp"
 #include "serializer.hpp"
 
@@ -118,6 +119,6 @@ private:
   void *udata_wr;
 };
 
-extern Cartridge cartridge;
+extern SFC_LOCAL Cartridge cartridge;
 
 }
@@ -26,7 +26,7 @@
 
 namespace SuperFamicom {
 
-Cheat cheats;
+SFC_LOCAL Cheat cheats;
 
 bool Cheat::Code::operator==(const Code& code) const {
   if(address != code.address
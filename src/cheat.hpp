@@ -23,6 +23,8 @@
 #include <cstdint>
 #include <string>
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct Cheat {
@@ -45,7 +47,7 @@ struct Cheat {
   std::vector<Code> codes;
 };
 
-extern Cheat cheats;
+extern SFC_LOCAL Cheat cheats;
 
 }
 
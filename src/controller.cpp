@@ -137,8 +137,8 @@ private:
   bool pauselock;
 };
 
-ControllerPort controllerPort1;
-ControllerPort controllerPort2;
+SFC_LOCAL ControllerPort controllerPort1;
+SFC_LOCAL ControllerPort controllerPort2;
 
 Controller::Controller(unsigned deviceID) : port(deviceID) {
 }
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 // SNES controller port pinout:
@@ -67,7 +69,7 @@ struct ControllerPort {
   Controller* device = nullptr;
 };
 
-extern ControllerPort controllerPort1;
-extern ControllerPort controllerPort2;
+extern SFC_LOCAL ControllerPort controllerPort1;
+extern SFC_LOCAL ControllerPort controllerPort2;
 
 }
@@ -143,7 +143,7 @@ void ArmDSP::serialize(serializer& s) {
   s.integer(bridge.signal);
 }
 
-ArmDSP armdsp;
+SFC_LOCAL ArmDSP armdsp;
 
 void ArmDSP::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
@@ -22,6 +22,7 @@
 
 #include <vector>
 
+#include "instance.hpp"
 #include "processor/arm7tdmi.hpp"
 #include "sfc.hpp"
 
@@ -33,7 +34,7 @@ namespace SuperFamicom {
 //instruction execution forces ARM mode to remove ARMv4 THUMB access
 //there is a possibility the ARMv3 supports 26-bit mode; but cannot be verified
 
-struct ArmDSP : Processor::ARM7TDMI, Thread {
+struct ArmDSP final : Processor::ARM7TDMI, Thread {
   struct Bridge {
     struct Buffer {
       bool ready;
@@ -76,6 +77,6 @@ struct ArmDSP : Processor::ARM7TDMI, Thread {
   uint8_t programRAM[16 * 1024];
 };
 
-extern ArmDSP armdsp;
+extern SFC_LOCAL ArmDSP armdsp;
 
 }
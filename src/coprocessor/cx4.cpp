@@ -29,7 +29,7 @@
 
 namespace SuperFamicom {
 
-Cx4 cx4;
+SFC_LOCAL Cx4 cx4;
 
 static const uint8_t immediate_data[48] = {
   0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
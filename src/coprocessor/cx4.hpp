@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct Cx4 {
@@ -105,6 +107,6 @@ public:
   void writel(uint16_t, uint32_t);
 };
 
-extern Cx4 cx4;
+extern SFC_LOCAL Cx4 cx4;
 
 }
@@ -31,7 +31,7 @@ void DIP::serialize(serializer& s) {
   s.integer(value);
 }
 
-DIP dip;
+SFC_LOCAL DIP dip;
 
 void DIP::power() {
 }
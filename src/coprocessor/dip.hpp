@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct DIP {
@@ -33,6 +35,6 @@ struct DIP {
   uint8_t value = 0x00;
 };
 
-extern DIP dip;
+extern SFC_LOCAL DIP dip;
 
 }
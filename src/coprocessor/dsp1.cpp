@@ -26,8 +26,8 @@
 
 namespace SuperFamicom {
 
-DSP1 dsp1;
-static Dsp1 dsp1emu;
+SFC_LOCAL DSP1 dsp1;
+static SFC_LOCAL Dsp1 dsp1emu;
 
 void DSP1::serialize(serializer& s) {
   dsp1emu.serialize(s);
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct DSP1 {
@@ -31,6 +33,6 @@ struct DSP1 {
   void serialize(serializer&);
 };
 
-extern DSP1 dsp1;
+extern SFC_LOCAL DSP1 dsp1;
 
 }
@@ -198,7 +198,7 @@ void DSP2::op0d() {
   }
 }
 
-DSP2 dsp2;
+SFC_LOCAL DSP2 dsp2;
 
 void DSP2::serialize(serializer& s) {
   s.integer(status.waiting_for_command);
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct DSP2 {
@@ -61,6 +63,6 @@ struct DSP2 {
   void op0d();
 };
 
-extern DSP2 dsp2;
+extern SFC_LOCAL DSP2 dsp2;
 
 }
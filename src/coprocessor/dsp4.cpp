@@ -26,9 +26,9 @@
 
 namespace SuperFamicom {
 
-DSP4 dsp4;
-static DSP4_t dsp4emu;
-static DSP4_vars_t dsp4emu_vars;
+SFC_LOCAL DSP4 dsp4;
+static SFC_LOCAL DSP4_t dsp4emu;
+static SFC_LOCAL DSP4_vars_t dsp4emu_vars;
 
 void DSP4::serialize(serializer& s) {
   s.integer(dsp4emu.waiting4command);
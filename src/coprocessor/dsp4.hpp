@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct DSP4 {
@@ -31,6 +33,6 @@ struct DSP4 {
   void serialize(serializer&);
 };
 
-extern DSP4 dsp4;
+extern SFC_LOCAL DSP4 dsp4;
 
 }
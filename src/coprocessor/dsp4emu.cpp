@@ -49,8 +49,8 @@ inline void WRITE_WORD(uint8_t *addr, uint16_t data) {
   addr[1] = data >> 8;
 }
 
-static struct DSP4_t DSP4;
-static struct DSP4_vars_t DSP4_vars;
+static SFC_LOCAL struct DSP4_t DSP4;
+static SFC_LOCAL struct DSP4_vars_t DSP4_vars;
 
 // input protocol
 
@@ -1828,8 +1828,8 @@ static void DSP4_OP11(int16_t A, int16_t B, int16_t C, int16_t D, int16_t *M)
 
 //Processing Code
 
-uint8_t dsp4_byte;
-uint16_t dsp4_address;
+SFC_LOCAL uint8_t dsp4_byte;
+SFC_LOCAL uint16_t dsp4_address;
 
 void InitDSP4()
 {
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct DSP4_t
@@ -37,8 +39,8 @@ struct DSP4_t
   uint8_t output[512];
 };
 
-extern uint8_t dsp4_byte;
-extern uint16_t dsp4_address;
+extern SFC_LOCAL uint8_t dsp4_byte;
+extern SFC_LOCAL uint16_t dsp4_address;
 
 struct DSP4_vars_t
 {
@@ -446,7 +446,7 @@ void EpsonRTC::serialize(serializer& s) {
   s.integer(test);
 }
 
-EpsonRTC epsonrtc;
+SFC_LOCAL EpsonRTC epsonrtc;
 
 void EpsonRTC::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 //Epson RTC-4513 Real-Time Clock
@@ -109,6 +111,6 @@ struct EpsonRTC : Thread {
   void tickYear();
 };
 
-extern EpsonRTC epsonrtc;
+extern SFC_LOCAL EpsonRTC epsonrtc;
 
 }
@@ -35,7 +35,7 @@ void Event::serialize(serializer& s) {
   s.integer(scoreSecondsRemaining);
 }
 
-Event event;
+SFC_LOCAL Event event;
 
 void Event::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
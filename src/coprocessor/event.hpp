@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "instance.hpp"
 #include "memory.hpp"
 
 namespace SuperFamicom {
@@ -71,6 +72,6 @@ private:
   unsigned scoreSecondsRemaining;
 };
 
-extern Event event;
+extern SFC_LOCAL Event event;
 
 }
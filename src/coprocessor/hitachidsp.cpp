@@ -331,7 +331,7 @@ void HitachiDSP::serialize(serializer& s) {
   Thread::serialize(s);
 }
 
-HitachiDSP hitachidsp;
+SFC_LOCAL HitachiDSP hitachidsp;
 
 void HitachiDSP::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
@@ -350,6 +350,13 @@ void HitachiDSP::step(unsigned clocks) {
   synchronizeCPU();
 }
 
+//steps of this many clocks that can be taken before the CPU must run
+unsigned HitachiDSP::headroom(unsigned clocks) {
+  if(clock >= 0) return 0;
+  uint64_t steps = (uint64_t)(-clock - 1) / (clocks * (uint64_t)cpu.frequency);
+  return steps < 256 ? steps : 256;
+}
+
 void HitachiDSP::halt() {
   HG51B::halt();
   if(io.irq == 0) cpu.irq(r.i = 1);
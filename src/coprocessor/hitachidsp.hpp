@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "instance.hpp"
 #include "memory.hpp"
 #include "processor/hg51b.hpp"
 
@@ -31,6 +32,7 @@ struct HitachiDSP : Processor::HG51B, Thread {
 
   void synchronizeCPU();
   void step(unsigned) override;
+  unsigned headroom(unsigned) override;
   void halt() override;
 
   void unload();
@@ -71,6 +73,6 @@ struct HitachiDSP : Processor::HG51B, Thread {
   bool Mapping;
 };
 
-extern HitachiDSP hitachidsp;
+extern SFC_LOCAL HitachiDSP hitachidsp;
 
 }
@@ -34,13 +34,13 @@ extern "C" {
 //warning: the size of this object will be too large due to C++ size rules differing from C rules.
 //in practice, this won't pose a problem so long as the struct is never accessed from C++ code,
 //as the offsets of all member variables will be wrong compared to what the C SameBoy code expects.
-static GB_gameboy_t sameboy;
+static SFC_LOCAL GB_gameboy_t sameboy;
 
 namespace SuperFamicom {
 
-static Stream *stream;
+static SFC_LOCAL Stream *stream;
 
-ICD icd;
+SFC_LOCAL ICD icd;
 
 uint8_t& ICD::Packet::operator[](uint8_t address) {
   return data[address & 0x0f];
@@ -236,6 +236,7 @@ void ICD::writeIO(unsigned addr, uint8_t data) {
     }
 
     stream->setFrequency(this->frequency / 128, 0);
+    cpu.coprocessorSlack = 0;
     r6003 = data;
     return;
   }
@@ -22,6 +22,7 @@
 
 #include <vector>
 
+#include "instance.hpp"
 #include "sfc.hpp"
 
 namespace SuperFamicom {
@@ -113,6 +114,6 @@ public:
   uint32_t bitmap[160 * 144];
 };
 
-extern ICD icd;
+extern SFC_LOCAL ICD icd;
 
 }
@@ -59,7 +59,7 @@ void MCC::serialize(serializer& s) {
   s.integer(w.externallyWritable);
 }
 
-MCC mcc;
+SFC_LOCAL MCC mcc;
 
 void MCC::unload() {
   rom.reset();
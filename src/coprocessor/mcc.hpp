@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 //MCC - Memory Controller Chip
 //Custom logic chip inside the BS-X Satellaview base cartridge
 
@@ -71,6 +73,6 @@ private:
   //bit 15 = unknown (test register interface?)
 };
 
-extern MCC mcc;
+extern SFC_LOCAL MCC mcc;
 
 }
@@ -31,9 +31,9 @@
 
 namespace SuperFamicom {
 
-static Stream *stream;
+static SFC_LOCAL Stream *stream;
 
-MSU1 msu1;
+SFC_LOCAL MSU1 msu1;
 
 void MSU1::serialize(serializer& s) {
   Thread::serialize(s);
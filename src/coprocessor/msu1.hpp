@@ -22,6 +22,8 @@
 
 #include <istream>
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct MSU1 : Thread {
@@ -78,6 +80,6 @@ private:
   bool (*openMsuCallback)(void*, std::string, std::istream**);
 };
 
-extern MSU1 msu1;
+extern SFC_LOCAL MSU1 msu1;
 
 }
@@ -50,7 +50,7 @@ void NECDSP::serialize(serializer& s) {
   Thread::serialize(s);
 }
 
-NECDSP necdsp;
+SFC_LOCAL NECDSP necdsp;
 
 void NECDSP::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
@@ -68,8 +68,12 @@ void NECDSP::unload() {
 }
 
 void NECDSP::main() {
-  exec();
-  step(1);
+  //run until ahead of the CPU, returning to the scheduler each instruction
+  //only while synchronizing for a save state
+  do {
+    exec();
+    step(1);
+  } while(clock < 0 && !scheduler.synchronizing());
   synchronizeCPU();
 }
 
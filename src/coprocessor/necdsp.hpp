@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "instance.hpp"
 #include "processor/upd96050.hpp"
 
 namespace SuperFamicom {
@@ -44,6 +45,6 @@ struct NECDSP : Processor::uPD96050, Thread {
   unsigned Frequency = 0;
 };
 
-extern NECDSP necdsp;
+extern SFC_LOCAL NECDSP necdsp;
 
 }
@@ -33,7 +33,7 @@ void OBC1::serialize(serializer& s) {
   s.integer(status.shift);
 }
 
-OBC1 obc1;
+SFC_LOCAL OBC1 obc1;
 
 void OBC1::unload() {
   ram.reset();
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct OBC1 {
@@ -44,6 +46,6 @@ private:
   } status;
 };
 
-extern OBC1 obc1;
+extern SFC_LOCAL OBC1 obc1;
 
 }
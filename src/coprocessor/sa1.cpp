@@ -1218,7 +1218,7 @@ void SA1::serialize(serializer& s) {
   s.integer(mmio.overflow);
 }
 
-SA1 sa1;
+SFC_LOCAL SA1 sa1;
 
 void SA1::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
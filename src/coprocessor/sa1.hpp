@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "instance.hpp"
 #include "processor/wdc65816.hpp"
 
 namespace SuperFamicom {
@@ -301,6 +302,6 @@ private:
   } mmio;
 };
 
-extern SA1 sa1;
+extern SFC_LOCAL SA1 sa1;
 
 }
@@ -26,7 +26,7 @@
 
 namespace SuperFamicom {
 
-SDD1 sdd1;
+SFC_LOCAL SDD1 sdd1;
 
 //S-DD1 decompression algorithm implementation
 //original code written by Andreas Naive (public domain license)
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct SDD1 {
@@ -147,6 +149,6 @@ public:
   Decompressor decompressor;
 };
 
-extern SDD1 sdd1;
+extern SFC_LOCAL SDD1 sdd1;
 
 }
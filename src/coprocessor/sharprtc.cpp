@@ -197,7 +197,7 @@ void SharpRTC::serialize(serializer& s) {
   s.integer(weekday);
 }
 
-SharpRTC sharprtc;
+SFC_LOCAL SharpRTC sharprtc;
 
 void SharpRTC::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
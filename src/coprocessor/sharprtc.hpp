@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct SharpRTC : Thread {
@@ -64,6 +66,6 @@ struct SharpRTC : Thread {
   unsigned calculateWeekday(int, int, int);
 };
 
-extern SharpRTC sharprtc;
+extern SFC_LOCAL SharpRTC sharprtc;
 
 }
@@ -485,7 +485,7 @@ void SPC7110::serialize(serializer& s) {
   s.integer(r4834);
 }
 
-SPC7110 spc7110;
+SFC_LOCAL SPC7110 spc7110;
 
 SPC7110::SPC7110() {
   decompressor = new Decompressor(*this);
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct Decompressor;
@@ -140,6 +142,6 @@ private:
   uint8_t r4834;  //bank mapping settings
 };
 
-extern SPC7110 spc7110;
+extern SFC_LOCAL SPC7110 spc7110;
 
 }
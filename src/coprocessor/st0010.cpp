@@ -451,7 +451,7 @@ void ST0010::op_08() {
   writew(0x0012, y1);
 }
 
-ST0010 st0010;
+SFC_LOCAL ST0010 st0010;
 
 void ST0010::serialize(serializer& s) {
   s.array(ram);
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct ST0010 {
@@ -57,6 +59,6 @@ struct ST0010 {
   void op_01(int16_t, int16_t, int16_t&, int16_t&, int16_t&, int16_t&);
 };
 
-extern ST0010 st0010;
+extern SFC_LOCAL ST0010 st0010;
 
 }
@@ -32,6 +32,19 @@ static const uint8_t vector[16] = {
   0x00, 0x01, 0x08, 0x01, 0x00, 0x01, 0x0c, 0x01
 };
 
+//transposes an 8x8 bit matrix held one row per byte: byte n of the result
+//holds bit n of each of the eight pixels, i.e. one row of bitplane n
+static inline uint64_t bitplanes(const uint8_t *pixels) {
+  uint64_t x = 0;
+  for(unsigned i = 0; i < 8; ++i) x |= (uint64_t)pixels[i] << (i << 3);
+
+  uint64_t t;
+  t = (x ^ (x >>  7)) & 0x00aa00aa00aa00aaull; x ^= t ^ (t <<  7);
+  t = (x ^ (x >> 14)) & 0x0000cccc0000ccccull; x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ull; x ^= t ^ (t << 28);
+  return x;
+}
+
 //ROM / RAM access from the S-CPU
 
 bool SuperFX::synchronizing() const {
@@ -161,11 +174,11 @@ void SuperFX::flushPixelCache(PixelCache& pcache) {
   }
   unsigned bpp = 2 << (regs.scmr.md - (regs.scmr.md >> 1));  // = [regs.scmr.md]{ 2, 4, 4, 8 };
   unsigned addr = 0x700000 + (cn * (bpp << 3)) + (regs.scbr << 10) + ((y & 0x07) * 2);
+  uint64_t planes = bitplanes(pcache.data);
 
   for(unsigned n = 0; n < bpp; ++n) {
     unsigned byte = ((n >> 1) << 4) + (n & 1);  // = [n]{ 0, 1, 16, 17, 32, 33, 48, 49 };
-    uint8_t data = 0x00;
-    for(unsigned i = 0; i < 8; ++i) data |= ((pcache.data[i] >> n) & 1) << i;
+    uint8_t data = planes >> (n << 3);
     if(pcache.bitpend != 0xff) {
       step(regs.clsr ? 5 : 6);
       data &= pcache.bitpend;
@@ -223,20 +236,26 @@ void SuperFX::write(unsigned addr, uint8_t data) {
   }
 }
 
+//opcodes in a valid cache line are the common case and stay inline
 uint8_t SuperFX::readOpcode(uint16_t addr) {
+  uint16_t offset = addr - regs.cbr;
+  if(offset < 512 && cache.valid[offset >> 4]) {
+    step(regs.clsr ? 1 : 2);
+    return cache.buffer[offset];
+  }
+  return fetchOpcode(addr);
+}
+
+uint8_t SuperFX::fetchOpcode(uint16_t addr) {
   uint16_t offset = addr - regs.cbr;
   if(offset < 512) {
-    if(cache.valid[offset >> 4] == false) {
-      unsigned dp = offset & 0xfff0;
-      unsigned sp = (regs.pbr << 16) + ((regs.cbr + dp) & 0xfff0);
-      for(unsigned n = 0; n < 16; ++n) {
-        step(regs.clsr ? 5 : 6);
-        cache.buffer[dp++] = read(sp++);
-      }
-      cache.valid[offset >> 4] = true;
-    } else {
-      step(regs.clsr ? 1 : 2);
+    unsigned dp = offset & 0xfff0;
+    unsigned sp = (regs.pbr << 16) + ((regs.cbr + dp) & 0xfff0);
+    for(unsigned n = 0; n < 16; ++n) {
+      step(regs.clsr ? 5 : 6);
+      cache.buffer[dp++] = read(sp++);
     }
+    cache.valid[offset >> 4] = true;
     return cache.buffer[offset];
   }
 
@@ -453,7 +472,7 @@ void SuperFX::serialize(serializer& s) {
   s.array(ram.data(), ram.size());
 }
 
-SuperFX superfx;
+SFC_LOCAL SuperFX superfx;
 
 void SuperFX::synchronizeCPU() {
   if(clock >= 0) scheduler.resume(cpu.thread);
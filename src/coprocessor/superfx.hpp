@@ -20,11 +20,12 @@
 
 #pragma once
 
+#include "instance.hpp"
 #include "processor/gsu.hpp"
 
 namespace SuperFamicom {
 
-struct SuperFX : Processor::GSU, Thread {
+struct SuperFX final : Processor::GSU, Thread {
   ReadableMemory rom;
   WritableMemory ram;
 
@@ -59,7 +60,8 @@ struct SuperFX : Processor::GSU, Thread {
   uint8_t read(unsigned, uint8_t = 0x00) override;
   void write(unsigned, uint8_t) override;
 
-  uint8_t readOpcode(uint16_t);
+  inline uint8_t readOpcode(uint16_t);
+  uint8_t fetchOpcode(uint16_t);
   inline uint8_t peekpipe();
   inline uint8_t pipe() override;
 
@@ -92,6 +94,6 @@ private:
   unsigned ramMask;
 };
 
-extern SuperFX superfx;
+extern SFC_LOCAL SuperFX superfx;
 
 }
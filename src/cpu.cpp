@@ -18,6 +18,7 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
 #include <string>
 
 #include "serializer.hpp"
@@ -33,7 +34,7 @@
 
 namespace SuperFamicom {
 
-CPU cpu;
+SFC_LOCAL CPU cpu;
 
 static const unsigned dmaLengths[8] = {1, 2, 2, 4, 4, 4, 2, 4};
 
@@ -650,6 +651,26 @@ void CPU::stepOnce() {
   if(joypadCounter() == 0) joypadEdge();
 }
 
+//true when stepping the given clocks one edge at a time would only advance
+//the counters: the scanline does not end, no joypad edge is due, and every
+//NMI/IRQ poll inside the span would leave the interrupt state unchanged
+bool CPU::stepQuiet(unsigned clocks) const {
+  unsigned h = hcounter();
+  if(h < 10 || h + clocks >= hperiod()) return false;
+  if(io.autoJoypadPoll && (counter.cpu & 127) + clocks >= 128) return false;
+
+  if(status.nmiHold || status.nmiValid != (vcounter() >= ppu.vdisp())) return false;
+
+  if(status.irqHold || (status.irqLine && io.irqEnable && !status.irqTransition)) return false;
+  bool irqValid = io.irqEnable && (!io.virqEnable || vcounter() == io.vtime);
+  if(irqValid && io.hirqEnable) {
+    unsigned htime = io.htime + 10u;
+    if(htime >= h + 2 && htime <= h + clocks) return false;
+    irqValid = false;
+  }
+  return status.irqValid == irqValid;
+}
+
 template<unsigned Clocks, bool Synchronize>
 void CPU::step() {
   static_assert(Clocks == 2 || Clocks == 4 || Clocks == 6 || Clocks == 8 || Clocks == 10 || Clocks == 12, "invalid number of clock cycles");
@@ -659,12 +680,17 @@ void CPU::step() {
     coprocessor->clock -= Clocks * (uint64_t)coprocessor->frequency;
   }
 
-  if(Clocks >=  2) stepOnce();
-  if(Clocks >=  4) stepOnce();
-  if(Clocks >=  6) stepOnce();
-  if(Clocks >=  8) stepOnce();
-  if(Clocks >= 10) stepOnce();
-  if(Clocks >= 12) stepOnce();
+  if(Clocks >= 4 && stepQuiet(Clocks)) {
+    counter.cpu += Clocks;
+    tick(Clocks);
+  } else {
+    if(Clocks >=  2) stepOnce();
+    if(Clocks >=  4) stepOnce();
+    if(Clocks >=  6) stepOnce();
+    if(Clocks >=  8) stepOnce();
+    if(Clocks >= 10) stepOnce();
+    if(Clocks >= 12) stepOnce();
+  }
 
   smp.clock -= Clocks * (uint64_t)smp.frequency;
   ppu.clock -= Clocks;
@@ -700,8 +726,9 @@ void CPU::step() {
     }
   }
 
-  if (Synchronize && !configuration.coprocessor.delayedSync) {
-    synchronizeCoprocessors();
+  coprocessorSlack -= Clocks;
+  if (Synchronize && !configuration.coprocessor.delayedSync && coprocessorSlack < 0) {
+    scheduleCoprocessors();
   }
 }
 
@@ -721,7 +748,7 @@ void CPU::scanline() {
   //forcefully sync S-CPU to other processors, in case chips are not communicating
   synchronizeSMP();
   synchronizePPU();
-  synchronizeCoprocessors();
+  scheduleCoprocessors();
 
   if(vcounter() == 0) {
     //HDMA setup triggers once every frame
@@ -959,6 +986,7 @@ void CPU::lastCycle() {
 }
 
 void CPU::serialize(serializer& s) {
+  coprocessorSlack = 0;  //coprocessor clocks may be replaced
   WDC65816::serialize(s);
   Thread::serialize(s);
   PPUcounter::serialize(s);
@@ -1068,12 +1096,29 @@ void CPU::synchronizePPU() {
   if(ppu.clock < 0) scheduler.resume(ppu.thread);
 }
 
+//coprocessor bus handlers call this on every access, so it leaves the
+//deadline alone: catching a coprocessor up only moves it further out
 void CPU::synchronizeCoprocessors() {
   for(Thread* coprocessor : coprocessors) {
     if(coprocessor->clock < 0) scheduler.resume(coprocessor->thread);
   }
 }
 
+//coprocessors only fall behind as the CPU steps, so after catching them up
+//the next deadline is known: the least time any of them is ahead of the CPU
+void CPU::scheduleCoprocessors() {
+  int64_t slack = INT64_MAX;
+  for(Thread* coprocessor : coprocessors) {
+    if(coprocessor->clock < 0) scheduler.resume(coprocessor->thread);
+    int64_t ahead = 0;
+    if(coprocessor->clock >= (int64_t)coprocessor->frequency) {
+      ahead = coprocessor->clock / coprocessor->frequency;
+    }
+    if(ahead < slack) slack = ahead;
+  }
+  coprocessorSlack = slack;
+}
+
 [[noreturn]] static void Enter() {
   while(true) {
     scheduler.synchronize();
@@ -1118,6 +1163,7 @@ void CPU::power(bool reset) {
   WDC65816::power();
   Thread::create(Enter, system.cpuFrequency());
   coprocessors.clear();
+  coprocessorSlack = 0;
   PPUcounter::reset();
   PPUcounter::scanline = {&CPU::scanline, this};
 
@@ -1126,8 +1172,8 @@ void CPU::power(bool reset) {
 
   reader = {&CPU::readRAM, this};
   writer = {&CPU::writeRAM, this};
-  bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000);
-  bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000);
+  bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000, 0, 0, wram, wram);
+  bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000, 0, 0, wram, wram);
 
   reader = {&CPU::readAPU, this};
   writer = {&CPU::writeAPU, this};
@@ -22,6 +22,7 @@
 
 #include <vector>
 
+#include "instance.hpp"
 #include "ppu.hpp"
 #include "processor/wdc65816.hpp"
 
@@ -77,8 +78,10 @@ struct CPU : Processor::WDC65816, Thread, PPUcounter {
   inline unsigned joypadCounter() const;
 
   alwaysinline void stepOnce();
+  inline bool stepQuiet(unsigned) const;
   inline void step(unsigned);
   template<unsigned, bool> void step();
+  void scheduleCoprocessors();
   void scanline();
 
   inline void aluEdge();
@@ -100,6 +103,7 @@ struct CPU : Processor::WDC65816, Thread, PPUcounter {
 
   uint8_t wram[128 * 1024];
   std::vector<Thread*> coprocessors;
+  int64_t coprocessorSlack = 0;  //CPU clocks before a coprocessor can fall behind
 
 private:
   bool init = false;
@@ -266,7 +270,7 @@ private:
   } channels[8];
 };
 
-extern CPU cpu;
+extern SFC_LOCAL CPU cpu;
 
 bool CPU::refresh() const {
   return status.dramRefresh == 1;
@@ -30,9 +30,9 @@
 
 namespace SuperFamicom {
 
-static Stream *stream;
+static SFC_LOCAL Stream *stream;
 
-DSP dsp;
+SFC_LOCAL DSP dsp;
 
 static void dsp_state_save(unsigned char** out, void* in, size_t size) {
   memcpy(*out, in, size);
@@ -67,19 +67,15 @@ void DSP::serialize(serializer& s) {
   }
 }
 
+//run every DSP clock owed to the SMP in a single batch
 void DSP::main() {
-  spc_dsp_run(1);
-  clock += 2;
+  int clocks = (1 - clock) >> 1;
+  spc_dsp_run(clocks);
+  clock += clocks << 1;
 
   int count = spc_dsp_sample_count();
   if(count > 0) {
-    if(!system.runAhead) {
-      for(int n = 0; n < count; n += 2) {
-        int16_t left  = samplebuffer[n + 0];
-        int16_t right = samplebuffer[n + 1];
-        stream->sample(left, right);
-      }
-    }
+    if(!system.runAhead) stream->write(samplebuffer, count >> 1);
     spc_dsp_set_output(samplebuffer, 8192);
   }
 }
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct DSP {
@@ -45,6 +47,6 @@ private:
   int16_t samplebuffer[8192];
 };
 
-extern DSP dsp;
+extern SFC_LOCAL DSP dsp;
 
 }
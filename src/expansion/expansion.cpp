@@ -29,7 +29,7 @@
 
 namespace SuperFamicom {
 
-ExpansionPort expansionPort;
+SFC_LOCAL ExpansionPort expansionPort;
 
 Expansion::Expansion() {
 }
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct Expansion {
@@ -37,6 +39,6 @@ struct ExpansionPort {
   Expansion* device = nullptr;
 };
 
-extern ExpansionPort expansionPort;
+extern SFC_LOCAL ExpansionPort expansionPort;
 
 }
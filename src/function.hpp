@@ -33,6 +33,7 @@ template<typename T> struct bfunction;
 template<typename R, typename... P> struct bfunction<R (P...)> {
   template<typename L> struct is_compatible {
     template<typename T> static const typename std::is_same<R, decltype(std::declval<T>().operator()(std::declval<P>()...))>::type exists(T*);
+    template<typename T> static const std::false_type exists(...);
     static constexpr bool value = decltype(exists<L>(0))::value;
   };
 
@@ -21,7 +21,7 @@
 
 #include "logger.hpp"
 
-Logger logger;
+SFC_LOCAL Logger logger;
 
 static void log_default(void*, int, std::string& text) {
     std::cerr << text;
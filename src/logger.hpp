@@ -21,6 +21,8 @@
 
 #include <string>
 
+#include "instance.hpp"
+
 struct Logger {
   enum levels { DBG, INF, WRN, ERR };
 
@@ -32,4 +34,4 @@ struct Logger {
   void *udata;
 };
 
-extern Logger logger;
+extern SFC_LOCAL Logger logger;
@@ -18,24 +18,25 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "memory.hpp"
 
 namespace SuperFamicom {
 
-bool Memory::GlobalWriteEnable = false;
-Bus bus;
+SFC_LOCAL bool Memory::GlobalWriteEnable = false;
+SFC_LOCAL Bus bus;
 
 Memory::~Memory() {
   reset();
 }
 
 Bus::~Bus() {
-  if(lookup) delete[] lookup;
-  if(target) delete[] target;
+  if(page) delete[] page;
 }
 
 void Bus::reset() {
@@ -43,13 +44,15 @@ void Bus::reset() {
     reader[id].reset();
     writer[id].reset();
     counter[id] = 0;
+    readData[id] = nullptr;
+    writeData[id] = nullptr;
   }
 
-  if(lookup) delete[] lookup;
-  if(target) delete[] target;
+  if(page) delete[] page;
 
-  lookup = new uint8_t [16 * 1024 * 1024]();
-  target = new uint32_t[16 * 1024 * 1024]();
+  page = new Page[Pages]();
+  blocks.clear();
+  shared = 0;
 
   reader[0] = [](unsigned, uint8_t data) -> uint8_t { return data; };
   writer[0] = [](unsigned, uint8_t) -> void {};
@@ -58,15 +61,18 @@ void Bus::reset() {
 unsigned Bus::map(
   const bfunction<uint8_t (unsigned, uint8_t)>& read,
   const bfunction<void  (unsigned, uint8_t)>& write,
-  const std::string& addr, unsigned size, unsigned base, unsigned mask
+  const std::string& addr, unsigned size, unsigned base, unsigned mask,
+  uint8_t *readPtr, uint8_t *writePtr
 ) {
   unsigned id = 1;
   while(counter[id]) {
-    if(++id >= 256) return printf("SFC error: bus map exhausted\n"), 0;
+    if(++id >= Fine) return printf("SFC error: bus map exhausted\n"), 0;
   }
 
   reader[id] = read;
   writer[id] = write;
+  readData[id] = readPtr;
+  writeData[id] = writePtr;
 
   std::stringstream ss(addr);
   std::vector<std::string> p;
@@ -96,26 +102,44 @@ unsigned Bus::map(
 
       for(unsigned bank2 = bankRange[0]; bank2 <= bankRange[1]; ++bank2) {
         for(unsigned addr3 = addrRange[0]; addr3 <= addrRange[1]; ++addr3) {
-          unsigned pid = lookup[bank2 << 16 | addr3];
-          if(pid && --counter[pid] == 0) {
-            reader[pid].reset();
-            writer[pid].reset();
-          }
-
           unsigned offset = reduce(bank2 << 16 | addr3, mask);
           if(size) base = mirror(base, size);
           if(size) offset = base + mirror(offset, size - base);
-          lookup[bank2 << 16 | addr3] = id;
-          target[bank2 << 16 | addr3] = offset;
-          ++counter[id];
+          assign(bank2 << 16 | addr3, id, offset);
         }
       }
     }
   }
 
+  compact();
   return id;
 }
 
+unsigned Bus::map(
+  Memory& memory, const std::string& addr,
+  unsigned size, unsigned base, unsigned mask
+) {
+  return map({&Memory::read, &memory}, {&Memory::write, &memory},
+    addr, size, base, mask);
+}
+
+//ROM writes are only permitted while patching cheats, so they keep the callback
+unsigned Bus::map(
+  ReadableMemory& memory, const std::string& addr,
+  unsigned size, unsigned base, unsigned mask
+) {
+  return map({&ReadableMemory::read, &memory}, {&ReadableMemory::write, &memory},
+    addr, size, base, mask, memory.data(), nullptr);
+}
+
+unsigned Bus::map(
+  WritableMemory& memory, const std::string& addr,
+  unsigned size, unsigned base, unsigned mask
+) {
+  return map({&WritableMemory::read, &memory}, {&WritableMemory::write, &memory},
+    addr, size, base, mask, memory.data(), memory.data());
+}
+
 void Bus::unmap(const std::string& addr) {
   std::stringstream ss(addr);
   std::vector<std::string> p;
@@ -143,18 +167,100 @@ void Bus::unmap(const std::string& addr) {
 
       for(unsigned bank2 = bankRange[0]; bank2 <= bankRange[1]; ++bank2) {
         for(unsigned addr3 = addrRange[0]; addr3 <= addrRange[1]; ++addr3) {
-          unsigned pid = lookup[bank2 << 16 | addr3];
-          if(pid && --counter[pid] == 0) {
-            reader[pid].reset();
-            writer[pid].reset();
-          }
-
-          lookup[bank2 << 16 | addr3] = 0;
-          target[bank2 << 16 | addr3] = 0;
+          assign(bank2 << 16 | addr3, 0, 0);
         }
       }
     }
   }
+
+  compact();
+}
+
+void Bus::assign(unsigned addr, unsigned id, unsigned offset) {
+  Page& p = page[addr >> PageBits];
+  unsigned pid, poffset;
+  decode(p, addr, pid, poffset);
+
+  if(pid && --counter[pid] == 0) {
+    reader[pid].reset();
+    writer[pid].reset();
+    readData[pid] = nullptr;
+    writeData[pid] = nullptr;
+  }
+  if(id) ++counter[id];
+
+  unsigned first = addr & ~PageMask;
+
+  if(p.id != Fine) {
+    if(pid == id && (!id || poffset == offset)) return;
+
+    //split the page into a private block
+    Block block;
+    for(unsigned n = 0; n < PageSize; ++n) {
+      block.id[n] = pid;
+      block.offset[n] = pid ? p.target - first : 0;
+    }
+    p.id = Fine;
+    p.target = blocks.size();
+    blocks.push_back(block);
+  } else if(p.target < shared) {
+    //copy on write, as compact() may have shared this block between pages
+    Block block = blocks[p.target];
+    p.target = blocks.size();
+    blocks.push_back(block);
+  }
+
+  Block& block = blocks[p.target];
+  block.id[addr & PageMask] = id;
+  block.offset[addr & PageMask] = id ? offset - addr : 0;
+}
+
+void Bus::compact() {
+  //collapse pages that became uniform back into plain entries, and let pages
+  //with identical layouts (eg. MMIO mirrored across banks) share one block
+  std::vector<Block> packed;
+  std::unordered_map<uint64_t, unsigned> known;
+
+  for(unsigned n = 0; n < Pages; ++n) {
+    if(page[n].id != Fine) continue;
+    const Block& block = blocks[page[n].target];
+
+    bool uniform = true;
+    for(unsigned i = 1; i < PageSize && uniform; ++i) {
+      uniform = block.id[i] == block.id[0] && block.offset[i] == block.offset[0];
+    }
+    if(uniform) {
+      page[n].id = block.id[0];
+      page[n].target = block.id[0] ? (n << PageBits) + block.offset[0] : 0;
+      continue;
+    }
+
+    uint64_t hash = 14695981039346656037ull;
+    const uint8_t* bytes = (const uint8_t*)&block;
+    for(unsigned i = 0; i < sizeof(Block); ++i) {
+      hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+
+    auto match = known.find(hash);
+    if(match != known.end() && !memcmp(&packed[match->second], &block, sizeof(Block))) {
+      page[n].target = match->second;
+      continue;
+    }
+
+    if(match == known.end()) known[hash] = packed.size();
+    page[n].target = packed.size();
+    packed.push_back(block);
+  }
+
+  blocks = std::move(packed);
+  shared = blocks.size();
+
+  for(unsigned n = 0; n < Pages; ++n) {
+    Page& p = page[n];
+    bool plain = p.id != Fine;
+    p.read = plain && readData[p.id] ? readData[p.id] + p.target : nullptr;
+    p.write = plain && writeData[p.id] ? writeData[p.id] + p.target : nullptr;
+  }
 }
 
 }
@@ -22,13 +22,15 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "function.hpp"
+#include "instance.hpp"
 
 namespace SuperFamicom {
 
 struct Memory {
-  static bool GlobalWriteEnable;
+  static SFC_LOCAL bool GlobalWriteEnable;
 
   virtual ~Memory();
   inline explicit operator bool() const;
@@ -90,20 +92,60 @@ struct Bus {
   unsigned map(
     const bfunction<uint8_t (unsigned, uint8_t)>&,
     const bfunction<void (unsigned, uint8_t)>&,
-    const std::string&, unsigned = 0, unsigned = 0, unsigned = 0
+    const std::string&, unsigned = 0, unsigned = 0, unsigned = 0,
+    uint8_t* = nullptr, uint8_t* = nullptr
   );
+  unsigned map(Memory&, const std::string&, unsigned = 0, unsigned = 0, unsigned = 0);
+  unsigned map(ReadableMemory&, const std::string&, unsigned = 0, unsigned = 0, unsigned = 0);
+  unsigned map(WritableMemory&, const std::string&, unsigned = 0, unsigned = 0, unsigned = 0);
   void unmap(const std::string&);
 
 private:
-  uint8_t *lookup = nullptr;
-  uint32_t *target = nullptr;
+  //the 24-bit address space is split into 256-byte pages. A page holds the id
+  //and the target of its first byte when the whole page belongs to one
+  //mapping and its targets are contiguous. Otherwise its id is Fine and the
+  //target selects a block holding per-byte ids and target offsets. A page
+  //held entirely in plain memory also keeps host pointers to it, so that one
+  //load both finds the page and tells which path it takes.
+  static constexpr unsigned PageBits = 8;
+  static constexpr unsigned PageSize = 1 << PageBits;
+  static constexpr unsigned PageMask = PageSize - 1;
+  static constexpr unsigned Pages = 1 << (24 - PageBits);
+  static constexpr unsigned Fine = 0xff;
+
+  struct Block {
+    uint8_t id[PageSize];
+    uint32_t offset[PageSize];  //target - address, modulo 2^32
+  };
+
+  struct Page {
+    uint8_t *read = nullptr;   //host memory of the page, or null for callbacks
+    uint8_t *write = nullptr;
+    uint32_t target = 0;       //block index when id is Fine
+    uint8_t id = 0;
+  };
+
+  inline void decode(const Page&, unsigned, unsigned&, unsigned&) const;
+  void assign(unsigned, unsigned, unsigned);
+  void compact();
+
+  Page *page = nullptr;
+  std::vector<Block> blocks;
+  unsigned shared = 0;  //blocks below this index may be referenced by many pages
 
   bfunction<uint8_t (unsigned, uint8_t)> reader[256];
   bfunction<void  (unsigned, uint8_t)> writer[256];
   unsigned counter[256];
+
+  //host pointers of plain memory, from which compact() fills in the pages.
+  //MMIO mappings leave them null and fall back to the reader/writer
+  //callbacks, as does memory which must synchronize a coprocessor or bank
+  //through its registers first, such as the SA-1's ROM, BW-RAM and I-RAM
+  uint8_t *readData[256];
+  uint8_t *writeData[256];
 };
 
-extern Bus bus;
+extern SFC_LOCAL Bus bus;
 
 Memory::operator bool() const {
   return size() > 0;
@@ -208,12 +250,32 @@ unsigned Bus::reduce(unsigned addr, unsigned mask) {
   return addr;
 }
 
+void Bus::decode(const Page& p, unsigned addr, unsigned& id, unsigned& offset) const {
+  id = p.id;
+  offset = p.target + (addr & PageMask);
+  if(id != Fine) return;
+  const Block& block = blocks[p.target];
+  id = block.id[addr & PageMask];
+  offset = addr + block.offset[addr & PageMask];
+}
+
 uint8_t Bus::read(unsigned addr, uint8_t data) {
-  return reader[lookup[addr]](target[addr], data);
+  const Page& p = page[addr >> PageBits];
+  if(p.read) return p.read[addr & PageMask];
+  unsigned id, offset;
+  decode(p, addr, id, offset);
+  return reader[id](offset, data);
 }
 
 void Bus::write(unsigned addr, uint8_t data) {
-  return writer[lookup[addr]](target[addr], data);
+  const Page& p = page[addr >> PageBits];
+  if(p.write) {
+    p.write[addr & PageMask] = data;
+    return;
+  }
+  unsigned id, offset;
+  decode(p, addr, id, offset);
+  return writer[id](offset, data);
 }
 
 }
@@ -29,7 +29,7 @@
 
 namespace SuperFamicom {
 
-PPU ppu;
+SFC_LOCAL PPU ppu;
 
 static const unsigned vramIncrementSizes[4] = {1, 32, 128, 128};
 
@@ -51,6 +51,7 @@ void PPU::main() {
     }*/
     display.interlace = io.interlace;
     display.overscan = io.overscan;
+    display.skip = configuration.video.skipRender;
     obj.frame();
   }
 
@@ -229,6 +230,13 @@ void PPU::cycle() {
   if(Cycle >=  0 && Cycle <= 1016 && (Cycle -  0) % 8 == 0)
     cycleObjectEvaluate();
 
+  //skipped frames only evaluate and fetch objects, for the range and time
+  //over flags; everything else here only feeds the output
+  if(display.skip) {
+    step();
+    return;
+  }
+
   if(Cycle >=  0 && Cycle <= 1054 && (Cycle -  0) % 4 == 0)
     cycleBackgroundFetch<(Cycle - 0) / 4 & 7>();
 
@@ -1775,6 +1783,10 @@ void PPU::Screen::run() {
   unsigned belowColor = below(hires);
   unsigned aboveColor = above();
 
+  //run-ahead frames are never shown. Choosing the colors still has to happen,
+  //as it sets the CGRAM address latch and color math state, but not output
+  if(system.runAhead) return;
+
   *lineA++ = *lineB++ = ppu.lightTable[ppu.io.displayBrightness][hires ? belowColor : aboveColor];
   *lineA++ = *lineB++ = ppu.lightTable[ppu.io.displayBrightness][aboveColor];
 }
@@ -2221,15 +2233,6 @@ void PPUcounter::serialize(serializer& s) {
   s.integer(last.hperiod);
 }
 
-void PPUcounter::tick(unsigned clocks) {
-  time.hcounter += clocks;
-  if(time.hcounter >= hperiod()) {
-    last.hperiod = hperiod();
-    time.hcounter -= hperiod();
-    tickScanline();
-  }
-}
-
 /* one PPU dot = 4 CPU clocks.
 
    PPU dots 323 and 327 are 6 CPU clocks long.
@@ -2452,7 +2455,7 @@ void PPU::power(bool reset) {
 }
 
 void PPU::refresh() {
-  if(system.runAhead) return;
+  if(system.runAhead || display.skip) return;
   unsigned pitch  = 512;
   unsigned width  = 512;
   unsigned height = ppu.display.interlace ? 480 : 240;
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "function.hpp"
+#include "instance.hpp"
 #include "sfc.hpp"
 #include "system.hpp"
 
@@ -143,6 +144,7 @@ private:
   struct {
     bool interlace;
     bool overscan;
+    bool skip;
     unsigned vdisp;
   } display;
 
@@ -523,7 +525,7 @@ private:
   friend struct System;
 };
 
-extern PPU ppu;
+extern SFC_LOCAL PPU ppu;
 
 bool PPU::interlace() const {
   return display.interlace;
@@ -542,6 +544,15 @@ void PPUcounter::tick() {
   }
 }
 
+void PPUcounter::tick(unsigned clocks) {
+  time.hcounter += clocks;
+  if(time.hcounter >= hperiod()) {
+    last.hperiod = hperiod();
+    time.hcounter -= hperiod();
+    tickScanline();
+  }
+}
+
 void PPUcounter::tickScanline() {
   if(++time.vcounter == 128) {
     //it's not important when this is captured: it is only needed at V=240 or V=311.
@@ -42,7 +42,7 @@ ARM7TDMI::GPR& ARM7TDMI::GPR::operator=(uint32_t value) {
   return *this;
 }
 
-ARM7TDMI::GPR& ARM7TDMI::r(uint8_t index) {
+ARM7TDMI::GPR& ARM7TDMI::banked(uint8_t index) {
   switch(index) {
   case  0: return processor.r0;
   case  1: return processor.r1;
@@ -78,6 +78,18 @@ ARM7TDMI::GPR& ARM7TDMI::r(uint8_t index) {
   throw std::terminate;
 }
 
+void ARM7TDMI::rebank() {
+  bankMode = processor.cpsr.m;
+  for(unsigned n = 0; n < 16; ++n) bank[n] = &banked(n);
+}
+
+//register accesses resolve the mode through the bank, which is only rebuilt
+//after cpsr.m changes
+ARM7TDMI::GPR& ARM7TDMI::r(uint8_t index) {
+  if(processor.cpsr.m != bankMode) rebank();
+  return *bank[index];
+}
+
 ARM7TDMI::PSR& ARM7TDMI::cpsr() {
   return processor.cpsr;
 }
@@ -279,7 +291,7 @@ void ARM7TDMI::instruction() {
 
   opcode = pipeline.execute.instruction;
   if(!pipeline.execute.thumb) {
-    if(!TST(opcode >> 28)) return;
+    if((opcode >> 28) != 0xe && !TST(opcode >> 28)) return;  //AL needs no test
     uint16_t index = (opcode & 0x0ff00000) >> 16 | (opcode & 0x000000f0) >> 4;
     armInstruction[index](opcode);
   } else {
@@ -1511,6 +1523,7 @@ void ARM7TDMI::Pipeline::serialize(serializer& s) {
 #undef _save
 
 ARM7TDMI::ARM7TDMI() {
+  rebank();
   armInitialize();
   thumbInitialize();
 }
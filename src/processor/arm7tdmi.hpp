@@ -54,6 +54,8 @@ struct ARM7TDMI {
   struct GPR;
   struct PSR;
   inline GPR& r(uint8_t);
+  GPR& banked(uint8_t);
+  void rebank();
   inline PSR& cpsr();
   inline PSR& spsr();
   inline bool privileged() const;
@@ -223,6 +225,10 @@ struct ARM7TDMI {
   bfunction<void ()> thumbInstruction[65536];
 
   uint32_t _pc;
+
+  //registers visible in the mode the bank was last built for
+  GPR* bank[16];
+  uint8_t bankMode;
 };
 
 }
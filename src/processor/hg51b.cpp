@@ -1341,10 +1341,26 @@ bool HG51B::cache() {
   if(io.cache.lock[io.cache.page]) return io.cache.enable = 0, false;
 
   io.cache.address[io.cache.page] = address;
-  for(unsigned offset = 0; offset < 256; ++offset) {
+
+  for(unsigned offset = 0; offset < 256;) {
+    //ROM fetches made before the CPU next gets to run see nothing it does, so
+    //they are taken in one pass; the fetch that lets the CPU run, and anything
+    //outside ROM, is stepped one word at a time as before
+    unsigned count = headroom(1 + io.wait.rom);
+    if(count > 256 - offset) count = 256 - offset;
+    if(count && !io.bus.enable && isROM(address) && isROM(address + count * 2 - 1)) {
+      uint16_t *page = programRAM[io.cache.page];
+      for(unsigned end = offset + count; offset < end; ++offset, address += 2) {
+        page[offset] = read(address) | read(address + 1) << 8;
+      }
+      step(count * (1 + io.wait.rom));
+      continue;
+    }
+
     step(wait(address));
     programRAM[io.cache.page][offset]  = read(address++);
     programRAM[io.cache.page][offset] |= read(address++) << 8;
+    ++offset;
   }
   return io.cache.enable = 0, true;
 }
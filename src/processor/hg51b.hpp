@@ -31,6 +31,7 @@ struct HG51B {
 
   virtual ~HG51B() = 0;
   virtual void step(unsigned);
+  virtual unsigned headroom(unsigned) = 0;
   virtual bool isROM(unsigned) = 0;
   virtual bool isRAM(unsigned) = 0;
   virtual uint8_t read(unsigned) = 0;
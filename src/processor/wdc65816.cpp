@@ -512,20 +512,23 @@ uint16_t WDC65816::algorithmTSB16(uint16_t data) {
   return data;
 }
 
-void WDC65816::ImmediateRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::ImmediateRead8() {
   lastCycle();
   W.r24_lsb4.l = fetch();
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::ImmediateRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::ImmediateRead16() {
   W.r24_lsb4.l = fetch();
   lastCycle();
   W.r24_lsb4.h = fetch();
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::BankRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::BankRead8() {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   lastCycle();
@@ -533,7 +536,8 @@ void WDC65816::BankRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::BankRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::BankRead16() {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   W.r24_lsb4.l = readBank(V.r24_lsb2.w + 0);
@@ -542,7 +546,8 @@ void WDC65816::BankRead16(alu16 op) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::BankRead8(alu8 op, r16 I) {
+template<WDC65816::alu8 op>
+void WDC65816::BankRead8(r16 I) {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   idle4(V.r24_lsb2.w, V.r24_lsb2.w + I.w);
@@ -551,7 +556,8 @@ void WDC65816::BankRead8(alu8 op, r16 I) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::BankRead16(alu16 op, r16 I) {
+template<WDC65816::alu16 op>
+void WDC65816::BankRead16(r16 I) {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   idle4(V.r24_lsb2.w, V.r24_lsb2.w + I.w);
@@ -561,7 +567,8 @@ void WDC65816::BankRead16(alu16 op, r16 I) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::LongRead8(alu8 op, r16 I) {
+template<WDC65816::alu8 op>
+void WDC65816::LongRead8(r16 I) {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   V.r24_lsb4.b = fetch();
@@ -570,7 +577,8 @@ void WDC65816::LongRead8(alu8 op, r16 I) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::LongRead16(alu16 op, r16 I) {
+template<WDC65816::alu16 op>
+void WDC65816::LongRead16(r16 I) {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   V.r24_lsb4.b = fetch();
@@ -580,7 +588,8 @@ void WDC65816::LongRead16(alu16 op, r16 I) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::DirectRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::DirectRead8() {
   U.r24_lsb4.l = fetch();
   idle2();
   lastCycle();
@@ -588,7 +597,8 @@ void WDC65816::DirectRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::DirectRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::DirectRead16() {
   U.r24_lsb4.l = fetch();
   idle2();
   W.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -597,7 +607,8 @@ void WDC65816::DirectRead16(alu16 op) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::DirectRead8(alu8 op, r16 I) {
+template<WDC65816::alu8 op>
+void WDC65816::DirectRead8(r16 I) {
   U.r24_lsb4.l = fetch();
   idle2();
   idle();
@@ -606,7 +617,8 @@ void WDC65816::DirectRead8(alu8 op, r16 I) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::DirectRead16(alu16 op, r16 I) {
+template<WDC65816::alu16 op>
+void WDC65816::DirectRead16(r16 I) {
   U.r24_lsb4.l = fetch();
   idle2();
   idle();
@@ -616,7 +628,8 @@ void WDC65816::DirectRead16(alu16 op, r16 I) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::IndirectRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::IndirectRead8() {
   U.r24_lsb4.l = fetch();
   idle2();
   V.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -626,7 +639,8 @@ void WDC65816::IndirectRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::IndirectRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::IndirectRead16() {
   U.r24_lsb4.l = fetch();
   idle2();
   V.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -637,7 +651,8 @@ void WDC65816::IndirectRead16(alu16 op) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::IndexedIndirectRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::IndexedIndirectRead8() {
   U.r24_lsb4.l = fetch();
   idle2();
   idle();
@@ -648,7 +663,8 @@ void WDC65816::IndexedIndirectRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::IndexedIndirectRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::IndexedIndirectRead16() {
   U.r24_lsb4.l = fetch();
   idle2();
   idle();
@@ -660,7 +676,8 @@ void WDC65816::IndexedIndirectRead16(alu16 op) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::IndirectIndexedRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::IndirectIndexedRead8() {
   U.r24_lsb4.l = fetch();
   idle2();
   V.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -671,7 +688,8 @@ void WDC65816::IndirectIndexedRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::IndirectIndexedRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::IndirectIndexedRead16() {
   U.r24_lsb4.l = fetch();
   idle2();
   V.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -683,7 +701,8 @@ void WDC65816::IndirectIndexedRead16(alu16 op) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::IndirectLongRead8(alu8 op, r16 I) {
+template<WDC65816::alu8 op>
+void WDC65816::IndirectLongRead8(r16 I) {
   U.r24_lsb4.l = fetch();
   idle2();
   V.r24_lsb4.l = readDirectN(U.r24_lsb4.l + 0);
@@ -694,7 +713,8 @@ void WDC65816::IndirectLongRead8(alu8 op, r16 I) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::IndirectLongRead16(alu16 op, r16 I) {
+template<WDC65816::alu16 op>
+void WDC65816::IndirectLongRead16(r16 I) {
   U.r24_lsb4.l = fetch();
   idle2();
   V.r24_lsb4.l = readDirectN(U.r24_lsb4.l + 0);
@@ -706,7 +726,8 @@ void WDC65816::IndirectLongRead16(alu16 op, r16 I) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::StackRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::StackRead8() {
   U.r24_lsb4.l = fetch();
   idle();
   lastCycle();
@@ -714,7 +735,8 @@ void WDC65816::StackRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::StackRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::StackRead16() {
   U.r24_lsb4.l = fetch();
   idle();
   W.r24_lsb4.l = readStack(U.r24_lsb4.l + 0);
@@ -723,7 +745,8 @@ void WDC65816::StackRead16(alu16 op) {
   alu(W.r24_lsb2.w);
 }
 
-void WDC65816::IndirectStackRead8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::IndirectStackRead8() {
   U.r24_lsb4.l = fetch();
   idle();
   V.r24_lsb4.l = readStack(U.r24_lsb4.l + 0);
@@ -734,7 +757,8 @@ void WDC65816::IndirectStackRead8(alu8 op) {
   alu(W.r24_lsb4.l);
 }
 
-void WDC65816::IndirectStackRead16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::IndirectStackRead16() {
   U.r24_lsb4.l = fetch();
   idle();
   V.r24_lsb4.l = readStack(U.r24_lsb4.l + 0);
@@ -945,19 +969,22 @@ void WDC65816::IndirectStackWrite16() {
   writeBank(V.r24_lsb2.w + Y.w + 1, A.r16_lsb2.h);
 }
 
-void WDC65816::ImpliedModify8(alu8 op, r16& M) {
+template<WDC65816::alu8 op>
+void WDC65816::ImpliedModify8(r16& M) {
   lastCycle();
   idleIRQ();
   M.r16_lsb2.l = alu(M.r16_lsb2.l);
 }
 
-void WDC65816::ImpliedModify16(alu16 op, r16& M) {
+template<WDC65816::alu16 op>
+void WDC65816::ImpliedModify16(r16& M) {
   lastCycle();
   idleIRQ();
   M.w = alu(M.w);
 }
 
-void WDC65816::BankModify8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::BankModify8() {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   W.r24_lsb4.l = readBank(V.r24_lsb2.w + 0);
@@ -967,7 +994,8 @@ void WDC65816::BankModify8(alu8 op) {
   writeBank(V.r24_lsb2.w + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::BankModify16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::BankModify16() {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   W.r24_lsb4.l = readBank(V.r24_lsb2.w + 0);
@@ -979,7 +1007,8 @@ void WDC65816::BankModify16(alu16 op) {
   writeBank(V.r24_lsb2.w + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::BankIndexedModify8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::BankIndexedModify8() {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   idle();
@@ -990,7 +1019,8 @@ void WDC65816::BankIndexedModify8(alu8 op) {
   writeBank(V.r24_lsb2.w + X.w + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::BankIndexedModify16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::BankIndexedModify16() {
   V.r24_lsb4.l = fetch();
   V.r24_lsb4.h = fetch();
   idle();
@@ -1003,7 +1033,8 @@ void WDC65816::BankIndexedModify16(alu16 op) {
   writeBank(V.r24_lsb2.w + X.w + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::DirectModify8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::DirectModify8() {
   U.r24_lsb4.l = fetch();
   idle2();
   W.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -1013,7 +1044,8 @@ void WDC65816::DirectModify8(alu8 op) {
   writeDirect(U.r24_lsb4.l + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::DirectModify16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::DirectModify16() {
   U.r24_lsb4.l = fetch();
   idle2();
   W.r24_lsb4.l = readDirect(U.r24_lsb4.l + 0);
@@ -1025,7 +1057,8 @@ void WDC65816::DirectModify16(alu16 op) {
   writeDirect(U.r24_lsb4.l + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::DirectIndexedModify8(alu8 op) {
+template<WDC65816::alu8 op>
+void WDC65816::DirectIndexedModify8() {
   U.r24_lsb4.l = fetch();
   idle2();
   idle();
@@ -1036,7 +1069,8 @@ void WDC65816::DirectIndexedModify8(alu8 op) {
   writeDirect(U.r24_lsb4.l + X.w + 0, W.r24_lsb4.l);
 }
 
-void WDC65816::DirectIndexedModify16(alu16 op) {
+template<WDC65816::alu16 op>
+void WDC65816::DirectIndexedModify16() {
   U.r24_lsb4.l = fetch();
   idle2();
   idle();
@@ -1506,268 +1540,276 @@ void WDC65816::interrupt() {
 
 //both the accumulator and index registers can independently be in either 8-bit or 16-bit mode.
 //controlled via the M/X flags, this changes the execution details of various instructions.
+//the M and X flags are fixed for the whole instruction, so each combination
+//gets its own copy of the decoder with the register widths resolved
+template<bool m, bool x>
 void WDC65816::instruction() {
   switch(fetch()) {
     //emulation mode lacks BRK vector; uses IRQ vector instead
     case 0x00: return Interrupt(EF ? (r16)0xfffe : (r16)0xffe6);
-    case 0x01: return MF ? IndexedIndirectRead8(&WDC65816::algorithmORA8) : IndexedIndirectRead16(&WDC65816::algorithmORA16);
+    case 0x01: return m ? IndexedIndirectRead8<&WDC65816::algorithmORA8>() : IndexedIndirectRead16<&WDC65816::algorithmORA16>();
     case 0x02: return Interrupt(EF ? (r16)0xfff4 : (r16)0xffe4);
-    case 0x03: return MF ? StackRead8(&WDC65816::algorithmORA8) : StackRead16(&WDC65816::algorithmORA16);
-    case 0x04: return MF ? DirectModify8(&WDC65816::algorithmTSB8) : DirectModify16(&WDC65816::algorithmTSB16);
-    case 0x05: return MF ? DirectRead8(&WDC65816::algorithmORA8) : DirectRead16(&WDC65816::algorithmORA16);
-    case 0x06: return MF ? DirectModify8(&WDC65816::algorithmASL8) : DirectModify16(&WDC65816::algorithmASL16);
-    case 0x07: return MF ? IndirectLongRead8(&WDC65816::algorithmORA8) : IndirectLongRead16(&WDC65816::algorithmORA16);
+    case 0x03: return m ? StackRead8<&WDC65816::algorithmORA8>() : StackRead16<&WDC65816::algorithmORA16>();
+    case 0x04: return m ? DirectModify8<&WDC65816::algorithmTSB8>() : DirectModify16<&WDC65816::algorithmTSB16>();
+    case 0x05: return m ? DirectRead8<&WDC65816::algorithmORA8>() : DirectRead16<&WDC65816::algorithmORA16>();
+    case 0x06: return m ? DirectModify8<&WDC65816::algorithmASL8>() : DirectModify16<&WDC65816::algorithmASL16>();
+    case 0x07: return m ? IndirectLongRead8<&WDC65816::algorithmORA8>() : IndirectLongRead16<&WDC65816::algorithmORA16>();
     case 0x08: return Push8((r16)P);
-    case 0x09: return MF ? ImmediateRead8(&WDC65816::algorithmORA8) : ImmediateRead16(&WDC65816::algorithmORA16);
-    case 0x0a: return MF ? ImpliedModify8(&WDC65816::algorithmASL8, A) : ImpliedModify16(&WDC65816::algorithmASL16, A);
+    case 0x09: return m ? ImmediateRead8<&WDC65816::algorithmORA8>() : ImmediateRead16<&WDC65816::algorithmORA16>();
+    case 0x0a: return m ? ImpliedModify8<&WDC65816::algorithmASL8>(A) : ImpliedModify16<&WDC65816::algorithmASL16>(A);
     case 0x0b: return PushD();
-    case 0x0c: return MF ? BankModify8(&WDC65816::algorithmTSB8) : BankModify16(&WDC65816::algorithmTSB16);
-    case 0x0d: return MF ? BankRead8(&WDC65816::algorithmORA8) : BankRead16(&WDC65816::algorithmORA16);
-    case 0x0e: return MF ? BankModify8(&WDC65816::algorithmASL8) : BankModify16(&WDC65816::algorithmASL16);
-    case 0x0f: return MF ? LongRead8(&WDC65816::algorithmORA8) : LongRead16(&WDC65816::algorithmORA16);
+    case 0x0c: return m ? BankModify8<&WDC65816::algorithmTSB8>() : BankModify16<&WDC65816::algorithmTSB16>();
+    case 0x0d: return m ? BankRead8<&WDC65816::algorithmORA8>() : BankRead16<&WDC65816::algorithmORA16>();
+    case 0x0e: return m ? BankModify8<&WDC65816::algorithmASL8>() : BankModify16<&WDC65816::algorithmASL16>();
+    case 0x0f: return m ? LongRead8<&WDC65816::algorithmORA8>() : LongRead16<&WDC65816::algorithmORA16>();
     case 0x10: return Branch(NF == 0);
-    case 0x11: return MF ? IndirectIndexedRead8(&WDC65816::algorithmORA8) : IndirectIndexedRead16(&WDC65816::algorithmORA16);
-    case 0x12: return MF ? IndirectRead8(&WDC65816::algorithmORA8) : IndirectRead16(&WDC65816::algorithmORA16);
-    case 0x13: return MF ? IndirectStackRead8(&WDC65816::algorithmORA8) : IndirectStackRead16(&WDC65816::algorithmORA16);
-    case 0x14: return MF ? DirectModify8(&WDC65816::algorithmTRB8) : DirectModify16(&WDC65816::algorithmTRB16);
-    case 0x15: return MF ? DirectRead8(&WDC65816::algorithmORA8, X) : DirectRead16(&WDC65816::algorithmORA16, X);
-    case 0x16: return MF ? DirectIndexedModify8(&WDC65816::algorithmASL8) : DirectIndexedModify16(&WDC65816::algorithmASL16);
-    case 0x17: return MF ? IndirectLongRead8(&WDC65816::algorithmORA8, Y) : IndirectLongRead16(&WDC65816::algorithmORA16, Y);
+    case 0x11: return m ? IndirectIndexedRead8<&WDC65816::algorithmORA8>() : IndirectIndexedRead16<&WDC65816::algorithmORA16>();
+    case 0x12: return m ? IndirectRead8<&WDC65816::algorithmORA8>() : IndirectRead16<&WDC65816::algorithmORA16>();
+    case 0x13: return m ? IndirectStackRead8<&WDC65816::algorithmORA8>() : IndirectStackRead16<&WDC65816::algorithmORA16>();
+    case 0x14: return m ? DirectModify8<&WDC65816::algorithmTRB8>() : DirectModify16<&WDC65816::algorithmTRB16>();
+    case 0x15: return m ? DirectRead8<&WDC65816::algorithmORA8>(X) : DirectRead16<&WDC65816::algorithmORA16>(X);
+    case 0x16: return m ? DirectIndexedModify8<&WDC65816::algorithmASL8>() : DirectIndexedModify16<&WDC65816::algorithmASL16>();
+    case 0x17: return m ? IndirectLongRead8<&WDC65816::algorithmORA8>(Y) : IndirectLongRead16<&WDC65816::algorithmORA16>(Y);
     case 0x18: return ClearFlag(CF);
-    case 0x19: return MF ? BankRead8(&WDC65816::algorithmORA8, Y) : BankRead16(&WDC65816::algorithmORA16, Y);
-    case 0x1a: return MF ? ImpliedModify8(&WDC65816::algorithmINC8, A) : ImpliedModify16(&WDC65816::algorithmINC16, A);
+    case 0x19: return m ? BankRead8<&WDC65816::algorithmORA8>(Y) : BankRead16<&WDC65816::algorithmORA16>(Y);
+    case 0x1a: return m ? ImpliedModify8<&WDC65816::algorithmINC8>(A) : ImpliedModify16<&WDC65816::algorithmINC16>(A);
     case 0x1b: return TransferCS();
-    case 0x1c: return MF ? BankModify8(&WDC65816::algorithmTRB8) : BankModify16(&WDC65816::algorithmTRB16);
-    case 0x1d: return MF ? BankRead8(&WDC65816::algorithmORA8, X) : BankRead16(&WDC65816::algorithmORA16, X);
-    case 0x1e: return MF ? BankIndexedModify8(&WDC65816::algorithmASL8) : BankIndexedModify16(&WDC65816::algorithmASL16);
-    case 0x1f: return MF ? LongRead8(&WDC65816::algorithmORA8, X) : LongRead16(&WDC65816::algorithmORA16, X);
+    case 0x1c: return m ? BankModify8<&WDC65816::algorithmTRB8>() : BankModify16<&WDC65816::algorithmTRB16>();
+    case 0x1d: return m ? BankRead8<&WDC65816::algorithmORA8>(X) : BankRead16<&WDC65816::algorithmORA16>(X);
+    case 0x1e: return m ? BankIndexedModify8<&WDC65816::algorithmASL8>() : BankIndexedModify16<&WDC65816::algorithmASL16>();
+    case 0x1f: return m ? LongRead8<&WDC65816::algorithmORA8>(X) : LongRead16<&WDC65816::algorithmORA16>(X);
     case 0x20: return CallShort();
-    case 0x21: return MF ? IndexedIndirectRead8(&WDC65816::algorithmAND8) : IndexedIndirectRead16(&WDC65816::algorithmAND16);
+    case 0x21: return m ? IndexedIndirectRead8<&WDC65816::algorithmAND8>() : IndexedIndirectRead16<&WDC65816::algorithmAND16>();
     case 0x22: return CallLong();
-    case 0x23: return MF ? StackRead8(&WDC65816::algorithmAND8) : StackRead16(&WDC65816::algorithmAND16);
-    case 0x24: return MF ? DirectRead8(&WDC65816::algorithmBIT8) : DirectRead16(&WDC65816::algorithmBIT16);
-    case 0x25: return MF ? DirectRead8(&WDC65816::algorithmAND8) : DirectRead16(&WDC65816::algorithmAND16);
-    case 0x26: return MF ? DirectModify8(&WDC65816::algorithmROL8) : DirectModify16(&WDC65816::algorithmROL16);
-    case 0x27: return MF ? IndirectLongRead8(&WDC65816::algorithmAND8) : IndirectLongRead16(&WDC65816::algorithmAND16);
+    case 0x23: return m ? StackRead8<&WDC65816::algorithmAND8>() : StackRead16<&WDC65816::algorithmAND16>();
+    case 0x24: return m ? DirectRead8<&WDC65816::algorithmBIT8>() : DirectRead16<&WDC65816::algorithmBIT16>();
+    case 0x25: return m ? DirectRead8<&WDC65816::algorithmAND8>() : DirectRead16<&WDC65816::algorithmAND16>();
+    case 0x26: return m ? DirectModify8<&WDC65816::algorithmROL8>() : DirectModify16<&WDC65816::algorithmROL16>();
+    case 0x27: return m ? IndirectLongRead8<&WDC65816::algorithmAND8>() : IndirectLongRead16<&WDC65816::algorithmAND16>();
     case 0x28: return PullP();
-    case 0x29: return MF ? ImmediateRead8(&WDC65816::algorithmAND8) : ImmediateRead16(&WDC65816::algorithmAND16);
-    case 0x2a: return MF ? ImpliedModify8(&WDC65816::algorithmROL8, A) : ImpliedModify16(&WDC65816::algorithmROL16, A);
+    case 0x29: return m ? ImmediateRead8<&WDC65816::algorithmAND8>() : ImmediateRead16<&WDC65816::algorithmAND16>();
+    case 0x2a: return m ? ImpliedModify8<&WDC65816::algorithmROL8>(A) : ImpliedModify16<&WDC65816::algorithmROL16>(A);
     case 0x2b: return PullD();
-    case 0x2c: return MF ? BankRead8(&WDC65816::algorithmBIT8) : BankRead16(&WDC65816::algorithmBIT16);
-    case 0x2d: return MF ? BankRead8(&WDC65816::algorithmAND8) : BankRead16(&WDC65816::algorithmAND16);
-    case 0x2e: return MF ? BankModify8(&WDC65816::algorithmROL8) : BankModify16(&WDC65816::algorithmROL16);
-    case 0x2f: return MF ? LongRead8(&WDC65816::algorithmAND8) : LongRead16(&WDC65816::algorithmAND16);
+    case 0x2c: return m ? BankRead8<&WDC65816::algorithmBIT8>() : BankRead16<&WDC65816::algorithmBIT16>();
+    case 0x2d: return m ? BankRead8<&WDC65816::algorithmAND8>() : BankRead16<&WDC65816::algorithmAND16>();
+    case 0x2e: return m ? BankModify8<&WDC65816::algorithmROL8>() : BankModify16<&WDC65816::algorithmROL16>();
+    case 0x2f: return m ? LongRead8<&WDC65816::algorithmAND8>() : LongRead16<&WDC65816::algorithmAND16>();
     case 0x30: return Branch(NF == 1);
-    case 0x31: return MF ? IndirectIndexedRead8(&WDC65816::algorithmAND8) : IndirectIndexedRead16(&WDC65816::algorithmAND16);
-    case 0x32: return MF ? IndirectRead8(&WDC65816::algorithmAND8) : IndirectRead16(&WDC65816::algorithmAND16);
-    case 0x33: return MF ? IndirectStackRead8(&WDC65816::algorithmAND8) : IndirectStackRead16(&WDC65816::algorithmAND16);
-    case 0x34: return MF ? DirectRead8(&WDC65816::algorithmBIT8, X) : DirectRead16(&WDC65816::algorithmBIT16, X);
-    case 0x35: return MF ? DirectRead8(&WDC65816::algorithmAND8, X) : DirectRead16(&WDC65816::algorithmAND16, X);
-    case 0x36: return MF ? DirectIndexedModify8(&WDC65816::algorithmROL8) : DirectIndexedModify16(&WDC65816::algorithmROL16);
-    case 0x37: return MF ? IndirectLongRead8(&WDC65816::algorithmAND8, Y) : IndirectLongRead16(&WDC65816::algorithmAND16, Y);
+    case 0x31: return m ? IndirectIndexedRead8<&WDC65816::algorithmAND8>() : IndirectIndexedRead16<&WDC65816::algorithmAND16>();
+    case 0x32: return m ? IndirectRead8<&WDC65816::algorithmAND8>() : IndirectRead16<&WDC65816::algorithmAND16>();
+    case 0x33: return m ? IndirectStackRead8<&WDC65816::algorithmAND8>() : IndirectStackRead16<&WDC65816::algorithmAND16>();
+    case 0x34: return m ? DirectRead8<&WDC65816::algorithmBIT8>(X) : DirectRead16<&WDC65816::algorithmBIT16>(X);
+    case 0x35: return m ? DirectRead8<&WDC65816::algorithmAND8>(X) : DirectRead16<&WDC65816::algorithmAND16>(X);
+    case 0x36: return m ? DirectIndexedModify8<&WDC65816::algorithmROL8>() : DirectIndexedModify16<&WDC65816::algorithmROL16>();
+    case 0x37: return m ? IndirectLongRead8<&WDC65816::algorithmAND8>(Y) : IndirectLongRead16<&WDC65816::algorithmAND16>(Y);
     case 0x38: return SetFlag(CF);
-    case 0x39: return MF ? BankRead8(&WDC65816::algorithmAND8, Y) : BankRead16(&WDC65816::algorithmAND16, Y);
-    case 0x3a: return MF ? ImpliedModify8(&WDC65816::algorithmDEC8, A) : ImpliedModify16(&WDC65816::algorithmDEC16, A);
+    case 0x39: return m ? BankRead8<&WDC65816::algorithmAND8>(Y) : BankRead16<&WDC65816::algorithmAND16>(Y);
+    case 0x3a: return m ? ImpliedModify8<&WDC65816::algorithmDEC8>(A) : ImpliedModify16<&WDC65816::algorithmDEC16>(A);
     case 0x3b: return Transfer16(S, A);
-    case 0x3c: return MF ? BankRead8(&WDC65816::algorithmBIT8, X) : BankRead16(&WDC65816::algorithmBIT16, X);
-    case 0x3d: return MF ? BankRead8(&WDC65816::algorithmAND8, X) : BankRead16(&WDC65816::algorithmAND16, X);
-    case 0x3e: return MF ? BankIndexedModify8(&WDC65816::algorithmROL8) : BankIndexedModify16(&WDC65816::algorithmROL16);
-    case 0x3f: return MF ? LongRead8(&WDC65816::algorithmAND8, X) : LongRead16(&WDC65816::algorithmAND16, X);
+    case 0x3c: return m ? BankRead8<&WDC65816::algorithmBIT8>(X) : BankRead16<&WDC65816::algorithmBIT16>(X);
+    case 0x3d: return m ? BankRead8<&WDC65816::algorithmAND8>(X) : BankRead16<&WDC65816::algorithmAND16>(X);
+    case 0x3e: return m ? BankIndexedModify8<&WDC65816::algorithmROL8>() : BankIndexedModify16<&WDC65816::algorithmROL16>();
+    case 0x3f: return m ? LongRead8<&WDC65816::algorithmAND8>(X) : LongRead16<&WDC65816::algorithmAND16>(X);
     case 0x40: return ReturnInterrupt();
-    case 0x41: return MF ? IndexedIndirectRead8(&WDC65816::algorithmEOR8) : IndexedIndirectRead16(&WDC65816::algorithmEOR16);
+    case 0x41: return m ? IndexedIndirectRead8<&WDC65816::algorithmEOR8>() : IndexedIndirectRead16<&WDC65816::algorithmEOR16>();
     case 0x42: return Prefix();
-    case 0x43: return MF ? StackRead8(&WDC65816::algorithmEOR8) : StackRead16(&WDC65816::algorithmEOR16);
-    case 0x44: return XF ? BlockMove8(-1) : BlockMove16(-1);
-    case 0x45: return MF ? DirectRead8(&WDC65816::algorithmEOR8) : DirectRead16(&WDC65816::algorithmEOR16);
-    case 0x46: return MF ? DirectModify8(&WDC65816::algorithmLSR8) : DirectModify16(&WDC65816::algorithmLSR16);
-    case 0x47: return MF ? IndirectLongRead8(&WDC65816::algorithmEOR8) : IndirectLongRead16(&WDC65816::algorithmEOR16);
-    case 0x48: return MF ? Push8(A) : Push16(A);
-    case 0x49: return MF ? ImmediateRead8(&WDC65816::algorithmEOR8) : ImmediateRead16(&WDC65816::algorithmEOR16);
-    case 0x4a: return MF ? ImpliedModify8(&WDC65816::algorithmLSR8, A) : ImpliedModify16(&WDC65816::algorithmLSR16, A);
+    case 0x43: return m ? StackRead8<&WDC65816::algorithmEOR8>() : StackRead16<&WDC65816::algorithmEOR16>();
+    case 0x44: return x ? BlockMove8(-1) : BlockMove16(-1);
+    case 0x45: return m ? DirectRead8<&WDC65816::algorithmEOR8>() : DirectRead16<&WDC65816::algorithmEOR16>();
+    case 0x46: return m ? DirectModify8<&WDC65816::algorithmLSR8>() : DirectModify16<&WDC65816::algorithmLSR16>();
+    case 0x47: return m ? IndirectLongRead8<&WDC65816::algorithmEOR8>() : IndirectLongRead16<&WDC65816::algorithmEOR16>();
+    case 0x48: return m ? Push8(A) : Push16(A);
+    case 0x49: return m ? ImmediateRead8<&WDC65816::algorithmEOR8>() : ImmediateRead16<&WDC65816::algorithmEOR16>();
+    case 0x4a: return m ? ImpliedModify8<&WDC65816::algorithmLSR8>(A) : ImpliedModify16<&WDC65816::algorithmLSR16>(A);
     case 0x4b: return Push8((r16)PC.r24_lsb4.b);
     case 0x4c: return JumpShort();
-    case 0x4d: return MF ? BankRead8(&WDC65816::algorithmEOR8) : BankRead16(&WDC65816::algorithmEOR16);
-    case 0x4e: return MF ? BankModify8(&WDC65816::algorithmLSR8) : BankModify16(&WDC65816::algorithmLSR16);
-    case 0x4f: return MF ? LongRead8(&WDC65816::algorithmEOR8) : LongRead16(&WDC65816::algorithmEOR16);
+    case 0x4d: return m ? BankRead8<&WDC65816::algorithmEOR8>() : BankRead16<&WDC65816::algorithmEOR16>();
+    case 0x4e: return m ? BankModify8<&WDC65816::algorithmLSR8>() : BankModify16<&WDC65816::algorithmLSR16>();
+    case 0x4f: return m ? LongRead8<&WDC65816::algorithmEOR8>() : LongRead16<&WDC65816::algorithmEOR16>();
     case 0x50: return Branch(VF == 0);
-    case 0x51: return MF ? IndirectIndexedRead8(&WDC65816::algorithmEOR8) : IndirectIndexedRead16(&WDC65816::algorithmEOR16);
-    case 0x52: return MF ? IndirectRead8(&WDC65816::algorithmEOR8) : IndirectRead16(&WDC65816::algorithmEOR16);
-    case 0x53: return MF ? IndirectStackRead8(&WDC65816::algorithmEOR8) : IndirectStackRead16(&WDC65816::algorithmEOR16);
-    case 0x54: return XF ? BlockMove8(+1) : BlockMove16(+1);
-    case 0x55: return MF ? DirectRead8(&WDC65816::algorithmEOR8, X) : DirectRead16(&WDC65816::algorithmEOR16, X);
-    case 0x56: return MF ? DirectIndexedModify8(&WDC65816::algorithmLSR8) : DirectIndexedModify16(&WDC65816::algorithmLSR16);
-    case 0x57: return MF ? IndirectLongRead8(&WDC65816::algorithmEOR8, Y) : IndirectLongRead16(&WDC65816::algorithmEOR16, Y);
+    case 0x51: return m ? IndirectIndexedRead8<&WDC65816::algorithmEOR8>() : IndirectIndexedRead16<&WDC65816::algorithmEOR16>();
+    case 0x52: return m ? IndirectRead8<&WDC65816::algorithmEOR8>() : IndirectRead16<&WDC65816::algorithmEOR16>();
+    case 0x53: return m ? IndirectStackRead8<&WDC65816::algorithmEOR8>() : IndirectStackRead16<&WDC65816::algorithmEOR16>();
+    case 0x54: return x ? BlockMove8(+1) : BlockMove16(+1);
+    case 0x55: return m ? DirectRead8<&WDC65816::algorithmEOR8>(X) : DirectRead16<&WDC65816::algorithmEOR16>(X);
+    case 0x56: return m ? DirectIndexedModify8<&WDC65816::algorithmLSR8>() : DirectIndexedModify16<&WDC65816::algorithmLSR16>();
+    case 0x57: return m ? IndirectLongRead8<&WDC65816::algorithmEOR8>(Y) : IndirectLongRead16<&WDC65816::algorithmEOR16>(Y);
     case 0x58: return ClearFlag(IF);
-    case 0x59: return MF ? BankRead8(&WDC65816::algorithmEOR8, Y) : BankRead16(&WDC65816::algorithmEOR16, Y);
-    case 0x5a: return XF ? Push8(Y) : Push16(Y);
+    case 0x59: return m ? BankRead8<&WDC65816::algorithmEOR8>(Y) : BankRead16<&WDC65816::algorithmEOR16>(Y);
+    case 0x5a: return x ? Push8(Y) : Push16(Y);
     case 0x5b: return Transfer16(A, D);
     case 0x5c: return JumpLong();
-    case 0x5d: return MF ? BankRead8(&WDC65816::algorithmEOR8, X) : BankRead16(&WDC65816::algorithmEOR16, X);
-    case 0x5e: return MF ? BankIndexedModify8(&WDC65816::algorithmLSR8) : BankIndexedModify16(&WDC65816::algorithmLSR16);
-    case 0x5f: return MF ? LongRead8(&WDC65816::algorithmEOR8, X) : LongRead16(&WDC65816::algorithmEOR16, X);
+    case 0x5d: return m ? BankRead8<&WDC65816::algorithmEOR8>(X) : BankRead16<&WDC65816::algorithmEOR16>(X);
+    case 0x5e: return m ? BankIndexedModify8<&WDC65816::algorithmLSR8>() : BankIndexedModify16<&WDC65816::algorithmLSR16>();
+    case 0x5f: return m ? LongRead8<&WDC65816::algorithmEOR8>(X) : LongRead16<&WDC65816::algorithmEOR16>(X);
     case 0x60: return ReturnShort();
-    case 0x61: return MF ? IndexedIndirectRead8(&WDC65816::algorithmADC8) : IndexedIndirectRead16(&WDC65816::algorithmADC16);
+    case 0x61: return m ? IndexedIndirectRead8<&WDC65816::algorithmADC8>() : IndexedIndirectRead16<&WDC65816::algorithmADC16>();
     case 0x62: return PushEffectiveRelativeAddress();
-    case 0x63: return MF ? StackRead8(&WDC65816::algorithmADC8) : StackRead16(&WDC65816::algorithmADC16);
-    case 0x64: return MF ? DirectWrite8(Z) : DirectWrite16(Z);
-    case 0x65: return MF ? DirectRead8(&WDC65816::algorithmADC8) : DirectRead16(&WDC65816::algorithmADC16);
-    case 0x66: return MF ? DirectModify8(&WDC65816::algorithmROR8) : DirectModify16(&WDC65816::algorithmROR16);
-    case 0x67: return MF ? IndirectLongRead8(&WDC65816::algorithmADC8) : IndirectLongRead16(&WDC65816::algorithmADC16);
-    case 0x68: return MF ? Pull8(A) : Pull16(A);
-    case 0x69: return MF ? ImmediateRead8(&WDC65816::algorithmADC8) : ImmediateRead16(&WDC65816::algorithmADC16);
-    case 0x6a: return MF ? ImpliedModify8(&WDC65816::algorithmROR8, A) : ImpliedModify16(&WDC65816::algorithmROR16, A);
+    case 0x63: return m ? StackRead8<&WDC65816::algorithmADC8>() : StackRead16<&WDC65816::algorithmADC16>();
+    case 0x64: return m ? DirectWrite8(Z) : DirectWrite16(Z);
+    case 0x65: return m ? DirectRead8<&WDC65816::algorithmADC8>() : DirectRead16<&WDC65816::algorithmADC16>();
+    case 0x66: return m ? DirectModify8<&WDC65816::algorithmROR8>() : DirectModify16<&WDC65816::algorithmROR16>();
+    case 0x67: return m ? IndirectLongRead8<&WDC65816::algorithmADC8>() : IndirectLongRead16<&WDC65816::algorithmADC16>();
+    case 0x68: return m ? Pull8(A) : Pull16(A);
+    case 0x69: return m ? ImmediateRead8<&WDC65816::algorithmADC8>() : ImmediateRead16<&WDC65816::algorithmADC16>();
+    case 0x6a: return m ? ImpliedModify8<&WDC65816::algorithmROR8>(A) : ImpliedModify16<&WDC65816::algorithmROR16>(A);
     case 0x6b: return ReturnLong();
     case 0x6c: return JumpIndirect();
-    case 0x6d: return MF ? BankRead8(&WDC65816::algorithmADC8) : BankRead16(&WDC65816::algorithmADC16);
-    case 0x6e: return MF ? BankModify8(&WDC65816::algorithmROR8) : BankModify16(&WDC65816::algorithmROR16);
-    case 0x6f: return MF ? LongRead8(&WDC65816::algorithmADC8) : LongRead16(&WDC65816::algorithmADC16);
+    case 0x6d: return m ? BankRead8<&WDC65816::algorithmADC8>() : BankRead16<&WDC65816::algorithmADC16>();
+    case 0x6e: return m ? BankModify8<&WDC65816::algorithmROR8>() : BankModify16<&WDC65816::algorithmROR16>();
+    case 0x6f: return m ? LongRead8<&WDC65816::algorithmADC8>() : LongRead16<&WDC65816::algorithmADC16>();
     case 0x70: return Branch(VF == 1);
-    case 0x71: return MF ? IndirectIndexedRead8(&WDC65816::algorithmADC8) : IndirectIndexedRead16(&WDC65816::algorithmADC16);
-    case 0x72: return MF ? IndirectRead8(&WDC65816::algorithmADC8) : IndirectRead16(&WDC65816::algorithmADC16);
-    case 0x73: return MF ? IndirectStackRead8(&WDC65816::algorithmADC8) : IndirectStackRead16(&WDC65816::algorithmADC16);
-    case 0x74: return MF ? DirectWrite8(Z, X) : DirectWrite16(Z, X);
-    case 0x75: return MF ? DirectRead8(&WDC65816::algorithmADC8, X) : DirectRead16(&WDC65816::algorithmADC16, X);
-    case 0x76: return MF ? DirectIndexedModify8(&WDC65816::algorithmROR8) : DirectIndexedModify16(&WDC65816::algorithmROR16);
-    case 0x77: return MF ? IndirectLongRead8(&WDC65816::algorithmADC8, Y) : IndirectLongRead16(&WDC65816::algorithmADC16, Y);
+    case 0x71: return m ? IndirectIndexedRead8<&WDC65816::algorithmADC8>() : IndirectIndexedRead16<&WDC65816::algorithmADC16>();
+    case 0x72: return m ? IndirectRead8<&WDC65816::algorithmADC8>() : IndirectRead16<&WDC65816::algorithmADC16>();
+    case 0x73: return m ? IndirectStackRead8<&WDC65816::algorithmADC8>() : IndirectStackRead16<&WDC65816::algorithmADC16>();
+    case 0x74: return m ? DirectWrite8(Z, X) : DirectWrite16(Z, X);
+    case 0x75: return m ? DirectRead8<&WDC65816::algorithmADC8>(X) : DirectRead16<&WDC65816::algorithmADC16>(X);
+    case 0x76: return m ? DirectIndexedModify8<&WDC65816::algorithmROR8>() : DirectIndexedModify16<&WDC65816::algorithmROR16>();
+    case 0x77: return m ? IndirectLongRead8<&WDC65816::algorithmADC8>(Y) : IndirectLongRead16<&WDC65816::algorithmADC16>(Y);
     case 0x78: return SetFlag(IF);
-    case 0x79: return MF ? BankRead8(&WDC65816::algorithmADC8, Y) : BankRead16(&WDC65816::algorithmADC16, Y);
-    case 0x7a: return XF ? Pull8(Y) : Pull16(Y);
+    case 0x79: return m ? BankRead8<&WDC65816::algorithmADC8>(Y) : BankRead16<&WDC65816::algorithmADC16>(Y);
+    case 0x7a: return x ? Pull8(Y) : Pull16(Y);
     case 0x7b: return Transfer16(D, A);
     case 0x7c: return JumpIndexedIndirect();
-    case 0x7d: return MF ? BankRead8(&WDC65816::algorithmADC8, X) : BankRead16(&WDC65816::algorithmADC16, X);
-    case 0x7e: return MF ? BankIndexedModify8(&WDC65816::algorithmROR8) : BankIndexedModify16(&WDC65816::algorithmROR16);
-    case 0x7f: return MF ? LongRead8(&WDC65816::algorithmADC8, X) : LongRead16(&WDC65816::algorithmADC16, X);
+    case 0x7d: return m ? BankRead8<&WDC65816::algorithmADC8>(X) : BankRead16<&WDC65816::algorithmADC16>(X);
+    case 0x7e: return m ? BankIndexedModify8<&WDC65816::algorithmROR8>() : BankIndexedModify16<&WDC65816::algorithmROR16>();
+    case 0x7f: return m ? LongRead8<&WDC65816::algorithmADC8>(X) : LongRead16<&WDC65816::algorithmADC16>(X);
     case 0x80: return Branch();
-    case 0x81: return MF ? IndexedIndirectWrite8() : IndexedIndirectWrite16();
+    case 0x81: return m ? IndexedIndirectWrite8() : IndexedIndirectWrite16();
     case 0x82: return BranchLong();
-    case 0x83: return MF ? StackWrite8() : StackWrite16();
-    case 0x84: return XF ? DirectWrite8(Y) : DirectWrite16(Y);
-    case 0x85: return MF ? DirectWrite8(A) : DirectWrite16(A);
-    case 0x86: return XF ? DirectWrite8(X) : DirectWrite16(X);
-    case 0x87: return MF ? IndirectLongWrite8() : IndirectLongWrite16();
-    case 0x88: return XF ? ImpliedModify8(&WDC65816::algorithmDEC8, Y) : ImpliedModify16(&WDC65816::algorithmDEC16, Y);
-    case 0x89: return MF ? BitImmediate8() : BitImmediate16();
-    case 0x8a: return MF ? Transfer8(X, A) : Transfer16(X, A);
+    case 0x83: return m ? StackWrite8() : StackWrite16();
+    case 0x84: return x ? DirectWrite8(Y) : DirectWrite16(Y);
+    case 0x85: return m ? DirectWrite8(A) : DirectWrite16(A);
+    case 0x86: return x ? DirectWrite8(X) : DirectWrite16(X);
+    case 0x87: return m ? IndirectLongWrite8() : IndirectLongWrite16();
+    case 0x88: return x ? ImpliedModify8<&WDC65816::algorithmDEC8>(Y) : ImpliedModify16<&WDC65816::algorithmDEC16>(Y);
+    case 0x89: return m ? BitImmediate8() : BitImmediate16();
+    case 0x8a: return m ? Transfer8(X, A) : Transfer16(X, A);
     case 0x8b: return Push8((r16)B);
-    case 0x8c: return XF ? BankWrite8(Y) : BankWrite16(Y);
-    case 0x8d: return MF ? BankWrite8(A) : BankWrite16(A);
-    case 0x8e: return XF ? BankWrite8(X) : BankWrite16(X);
-    case 0x8f: return MF ? LongWrite8() : LongWrite16();
+    case 0x8c: return x ? BankWrite8(Y) : BankWrite16(Y);
+    case 0x8d: return m ? BankWrite8(A) : BankWrite16(A);
+    case 0x8e: return x ? BankWrite8(X) : BankWrite16(X);
+    case 0x8f: return m ? LongWrite8() : LongWrite16();
     case 0x90: return Branch(CF == 0);
-    case 0x91: return MF ? IndirectIndexedWrite8() : IndirectIndexedWrite16();
-    case 0x92: return MF ? IndirectWrite8() : IndirectWrite16();
-    case 0x93: return MF ? IndirectStackWrite8() : IndirectStackWrite16();
-    case 0x94: return XF ? DirectWrite8(Y, X) : DirectWrite16(Y, X);
-    case 0x95: return MF ? DirectWrite8(A, X) : DirectWrite16(A, X);
-    case 0x96: return XF ? DirectWrite8(X, Y) : DirectWrite16(X, Y);
-    case 0x97: return MF ? IndirectLongWrite8(Y) : IndirectLongWrite16(Y);
-    case 0x98: return MF ? Transfer8(Y, A) : Transfer16(Y, A);
-    case 0x99: return MF ? BankWrite8(A, Y) : BankWrite16(A, Y);
+    case 0x91: return m ? IndirectIndexedWrite8() : IndirectIndexedWrite16();
+    case 0x92: return m ? IndirectWrite8() : IndirectWrite16();
+    case 0x93: return m ? IndirectStackWrite8() : IndirectStackWrite16();
+    case 0x94: return x ? DirectWrite8(Y, X) : DirectWrite16(Y, X);
+    case 0x95: return m ? DirectWrite8(A, X) : DirectWrite16(A, X);
+    case 0x96: return x ? DirectWrite8(X, Y) : DirectWrite16(X, Y);
+    case 0x97: return m ? IndirectLongWrite8(Y) : IndirectLongWrite16(Y);
+    case 0x98: return m ? Transfer8(Y, A) : Transfer16(Y, A);
+    case 0x99: return m ? BankWrite8(A, Y) : BankWrite16(A, Y);
     case 0x9a: return TransferXS();
-    case 0x9b: return XF ? Transfer8(X, Y) : Transfer16(X, Y);
-    case 0x9c: return MF ? BankWrite8(Z) : BankWrite16(Z);
-    case 0x9d: return MF ? BankWrite8(A, X) : BankWrite16(A, X);
-    case 0x9e: return MF ? BankWrite8(Z, X) : BankWrite16(Z, X);
-    case 0x9f: return MF ? LongWrite8(X) : LongWrite16(X);
-    case 0xa0: return XF ? ImmediateRead8(&WDC65816::algorithmLDY8) : ImmediateRead16(&WDC65816::algorithmLDY16);
-    case 0xa1: return MF ? IndexedIndirectRead8(&WDC65816::algorithmLDA8) : IndexedIndirectRead16(&WDC65816::algorithmLDA16);
-    case 0xa2: return XF ? ImmediateRead8(&WDC65816::algorithmLDX8) : ImmediateRead16(&WDC65816::algorithmLDX16);
-    case 0xa3: return MF ? StackRead8(&WDC65816::algorithmLDA8) : StackRead16(&WDC65816::algorithmLDA16);
-    case 0xa4: return XF ? DirectRead8(&WDC65816::algorithmLDY8) : DirectRead16(&WDC65816::algorithmLDY16);
-    case 0xa5: return MF ? DirectRead8(&WDC65816::algorithmLDA8) : DirectRead16(&WDC65816::algorithmLDA16);
-    case 0xa6: return XF ? DirectRead8(&WDC65816::algorithmLDX8) : DirectRead16(&WDC65816::algorithmLDX16);
-    case 0xa7: return MF ? IndirectLongRead8(&WDC65816::algorithmLDA8) : IndirectLongRead16(&WDC65816::algorithmLDA16);
-    case 0xa8: return XF ? Transfer8(A, Y) : Transfer16(A, Y);
-    case 0xa9: return MF ? ImmediateRead8(&WDC65816::algorithmLDA8) : ImmediateRead16(&WDC65816::algorithmLDA16);
-    case 0xaa: return XF ? Transfer8(A, X) : Transfer16(A, X);
+    case 0x9b: return x ? Transfer8(X, Y) : Transfer16(X, Y);
+    case 0x9c: return m ? BankWrite8(Z) : BankWrite16(Z);
+    case 0x9d: return m ? BankWrite8(A, X) : BankWrite16(A, X);
+    case 0x9e: return m ? BankWrite8(Z, X) : BankWrite16(Z, X);
+    case 0x9f: return m ? LongWrite8(X) : LongWrite16(X);
+    case 0xa0: return x ? ImmediateRead8<&WDC65816::algorithmLDY8>() : ImmediateRead16<&WDC65816::algorithmLDY16>();
+    case 0xa1: return m ? IndexedIndirectRead8<&WDC65816::algorithmLDA8>() : IndexedIndirectRead16<&WDC65816::algorithmLDA16>();
+    case 0xa2: return x ? ImmediateRead8<&WDC65816::algorithmLDX8>() : ImmediateRead16<&WDC65816::algorithmLDX16>();
+    case 0xa3: return m ? StackRead8<&WDC65816::algorithmLDA8>() : StackRead16<&WDC65816::algorithmLDA16>();
+    case 0xa4: return x ? DirectRead8<&WDC65816::algorithmLDY8>() : DirectRead16<&WDC65816::algorithmLDY16>();
+    case 0xa5: return m ? DirectRead8<&WDC65816::algorithmLDA8>() : DirectRead16<&WDC65816::algorithmLDA16>();
+    case 0xa6: return x ? DirectRead8<&WDC65816::algorithmLDX8>() : DirectRead16<&WDC65816::algorithmLDX16>();
+    case 0xa7: return m ? IndirectLongRead8<&WDC65816::algorithmLDA8>() : IndirectLongRead16<&WDC65816::algorithmLDA16>();
+    case 0xa8: return x ? Transfer8(A, Y) : Transfer16(A, Y);
+    case 0xa9: return m ? ImmediateRead8<&WDC65816::algorithmLDA8>() : ImmediateRead16<&WDC65816::algorithmLDA16>();
+    case 0xaa: return x ? Transfer8(A, X) : Transfer16(A, X);
     case 0xab: return PullB();
-    case 0xac: return XF ? BankRead8(&WDC65816::algorithmLDY8) : BankRead16(&WDC65816::algorithmLDY16);
-    case 0xad: return MF ? BankRead8(&WDC65816::algorithmLDA8) : BankRead16(&WDC65816::algorithmLDA16);
-    case 0xae: return XF ? BankRead8(&WDC65816::algorithmLDX8) : BankRead16(&WDC65816::algorithmLDX16);
-    case 0xaf: return MF ? LongRead8(&WDC65816::algorithmLDA8) : LongRead16(&WDC65816::algorithmLDA16);
+    case 0xac: return x ? BankRead8<&WDC65816::algorithmLDY8>() : BankRead16<&WDC65816::algorithmLDY16>();
+    case 0xad: return m ? BankRead8<&WDC65816::algorithmLDA8>() : BankRead16<&WDC65816::algorithmLDA16>();
+    case 0xae: return x ? BankRead8<&WDC65816::algorithmLDX8>() : BankRead16<&WDC65816::algorithmLDX16>();
+    case 0xaf: return m ? LongRead8<&WDC65816::algorithmLDA8>() : LongRead16<&WDC65816::algorithmLDA16>();
     case 0xb0: return Branch(CF == 1);
-    case 0xb1: return MF ? IndirectIndexedRead8(&WDC65816::algorithmLDA8) : IndirectIndexedRead16(&WDC65816::algorithmLDA16);
-    case 0xb2: return MF ? IndirectRead8(&WDC65816::algorithmLDA8) : IndirectRead16(&WDC65816::algorithmLDA16);
-    case 0xb3: return MF ? IndirectStackRead8(&WDC65816::algorithmLDA8) : IndirectStackRead16(&WDC65816::algorithmLDA16);
-    case 0xb4: return XF ? DirectRead8(&WDC65816::algorithmLDY8, X) : DirectRead16(&WDC65816::algorithmLDY16, X);
-    case 0xb5: return MF ? DirectRead8(&WDC65816::algorithmLDA8, X) : DirectRead16(&WDC65816::algorithmLDA16, X);
-    case 0xb6: return XF ? DirectRead8(&WDC65816::algorithmLDX8, Y) : DirectRead16(&WDC65816::algorithmLDX16, Y);
-    case 0xb7: return MF ? IndirectLongRead8(&WDC65816::algorithmLDA8, Y) : IndirectLongRead16(&WDC65816::algorithmLDA16, Y);
+    case 0xb1: return m ? IndirectIndexedRead8<&WDC65816::algorithmLDA8>() : IndirectIndexedRead16<&WDC65816::algorithmLDA16>();
+    case 0xb2: return m ? IndirectRead8<&WDC65816::algorithmLDA8>() : IndirectRead16<&WDC65816::algorithmLDA16>();
+    case 0xb3: return m ? IndirectStackRead8<&WDC65816::algorithmLDA8>() : IndirectStackRead16<&WDC65816::algorithmLDA16>();
+    case 0xb4: return x ? DirectRead8<&WDC65816::algorithmLDY8>(X) : DirectRead16<&WDC65816::algorithmLDY16>(X);
+    case 0xb5: return m ? DirectRead8<&WDC65816::algorithmLDA8>(X) : DirectRead16<&WDC65816::algorithmLDA16>(X);
+    case 0xb6: return x ? DirectRead8<&WDC65816::algorithmLDX8>(Y) : DirectRead16<&WDC65816::algorithmLDX16>(Y);
+    case 0xb7: return m ? IndirectLongRead8<&WDC65816::algorithmLDA8>(Y) : IndirectLongRead16<&WDC65816::algorithmLDA16>(Y);
     case 0xb8: return ClearFlag(VF);
-    case 0xb9: return MF ? BankRead8(&WDC65816::algorithmLDA8, Y) : BankRead16(&WDC65816::algorithmLDA16, Y);
-    case 0xba: return XF ? TransferSX8() : TransferSX16();
-    case 0xbb: return XF ? Transfer8(Y, X) : Transfer16(Y, X);
-    case 0xbc: return XF ? BankRead8(&WDC65816::algorithmLDY8, X) : BankRead16(&WDC65816::algorithmLDY16, X);
-    case 0xbd: return MF ? BankRead8(&WDC65816::algorithmLDA8, X) : BankRead16(&WDC65816::algorithmLDA16, X);
-    case 0xbe: return XF ? BankRead8(&WDC65816::algorithmLDX8, Y) : BankRead16(&WDC65816::algorithmLDX16, Y);
-    case 0xbf: return MF ? LongRead8(&WDC65816::algorithmLDA8, X) : LongRead16(&WDC65816::algorithmLDA16, X);
-    case 0xc0: return XF ? ImmediateRead8(&WDC65816::algorithmCPY8) : ImmediateRead16(&WDC65816::algorithmCPY16);
-    case 0xc1: return MF ? IndexedIndirectRead8(&WDC65816::algorithmCMP8) : IndexedIndirectRead16(&WDC65816::algorithmCMP16);
+    case 0xb9: return m ? BankRead8<&WDC65816::algorithmLDA8>(Y) : BankRead16<&WDC65816::algorithmLDA16>(Y);
+    case 0xba: return x ? TransferSX8() : TransferSX16();
+    case 0xbb: return x ? Transfer8(Y, X) : Transfer16(Y, X);
+    case 0xbc: return x ? BankRead8<&WDC65816::algorithmLDY8>(X) : BankRead16<&WDC65816::algorithmLDY16>(X);
+    case 0xbd: return m ? BankRead8<&WDC65816::algorithmLDA8>(X) : BankRead16<&WDC65816::algorithmLDA16>(X);
+    case 0xbe: return x ? BankRead8<&WDC65816::algorithmLDX8>(Y) : BankRead16<&WDC65816::algorithmLDX16>(Y);
+    case 0xbf: return m ? LongRead8<&WDC65816::algorithmLDA8>(X) : LongRead16<&WDC65816::algorithmLDA16>(X);
+    case 0xc0: return x ? ImmediateRead8<&WDC65816::algorithmCPY8>() : ImmediateRead16<&WDC65816::algorithmCPY16>();
+    case 0xc1: return m ? IndexedIndirectRead8<&WDC65816::algorithmCMP8>() : IndexedIndirectRead16<&WDC65816::algorithmCMP16>();
     case 0xc2: return ResetP();
-    case 0xc3: return MF ? StackRead8(&WDC65816::algorithmCMP8) : StackRead16(&WDC65816::algorithmCMP16);
-    case 0xc4: return XF ? DirectRead8(&WDC65816::algorithmCPY8) : DirectRead16(&WDC65816::algorithmCPY16);
-    case 0xc5: return MF ? DirectRead8(&WDC65816::algorithmCMP8) : DirectRead16(&WDC65816::algorithmCMP16);
-    case 0xc6: return MF ? DirectModify8(&WDC65816::algorithmDEC8) : DirectModify16(&WDC65816::algorithmDEC16);
-    case 0xc7: return MF ? IndirectLongRead8(&WDC65816::algorithmCMP8) : IndirectLongRead16(&WDC65816::algorithmCMP16);
-    case 0xc8: return XF ? ImpliedModify8(&WDC65816::algorithmINC8, Y) : ImpliedModify16(&WDC65816::algorithmINC16, Y);
-    case 0xc9: return MF ? ImmediateRead8(&WDC65816::algorithmCMP8) : ImmediateRead16(&WDC65816::algorithmCMP16);
-    case 0xca: return XF ? ImpliedModify8(&WDC65816::algorithmDEC8, X) : ImpliedModify16(&WDC65816::algorithmDEC16, X);
+    case 0xc3: return m ? StackRead8<&WDC65816::algorithmCMP8>() : StackRead16<&WDC65816::algorithmCMP16>();
+    case 0xc4: return x ? DirectRead8<&WDC65816::algorithmCPY8>() : DirectRead16<&WDC65816::algorithmCPY16>();
+    case 0xc5: return m ? DirectRead8<&WDC65816::algorithmCMP8>() : DirectRead16<&WDC65816::algorithmCMP16>();
+    case 0xc6: return m ? DirectModify8<&WDC65816::algorithmDEC8>() : DirectModify16<&WDC65816::algorithmDEC16>();
+    case 0xc7: return m ? IndirectLongRead8<&WDC65816::algorithmCMP8>() : IndirectLongRead16<&WDC65816::algorithmCMP16>();
+    case 0xc8: return x ? ImpliedModify8<&WDC65816::algorithmINC8>(Y) : ImpliedModify16<&WDC65816::algorithmINC16>(Y);
+    case 0xc9: return m ? ImmediateRead8<&WDC65816::algorithmCMP8>() : ImmediateRead16<&WDC65816::algorithmCMP16>();
+    case 0xca: return x ? ImpliedModify8<&WDC65816::algorithmDEC8>(X) : ImpliedModify16<&WDC65816::algorithmDEC16>(X);
     case 0xcb: return instructionWait();
-    case 0xcc: return XF ? BankRead8(&WDC65816::algorithmCPY8) : BankRead16(&WDC65816::algorithmCPY16);
-    case 0xcd: return MF ? BankRead8(&WDC65816::algorithmCMP8) : BankRead16(&WDC65816::algorithmCMP16);
-    case 0xce: return MF ? BankModify8(&WDC65816::algorithmDEC8) : BankModify16(&WDC65816::algorithmDEC16);
-    case 0xcf: return MF ? LongRead8(&WDC65816::algorithmCMP8) : LongRead16(&WDC65816::algorithmCMP16);
+    case 0xcc: return x ? BankRead8<&WDC65816::algorithmCPY8>() : BankRead16<&WDC65816::algorithmCPY16>();
+    case 0xcd: return m ? BankRead8<&WDC65816::algorithmCMP8>() : BankRead16<&WDC65816::algorithmCMP16>();
+    case 0xce: return m ? BankModify8<&WDC65816::algorithmDEC8>() : BankModify16<&WDC65816::algorithmDEC16>();
+    case 0xcf: return m ? LongRead8<&WDC65816::algorithmCMP8>() : LongRead16<&WDC65816::algorithmCMP16>();
     case 0xd0: return Branch(ZF == 0);
-    case 0xd1: return MF ? IndirectIndexedRead8(&WDC65816::algorithmCMP8) : IndirectIndexedRead16(&WDC65816::algorithmCMP16);
-    case 0xd2: return MF ? IndirectRead8(&WDC65816::algorithmCMP8) : IndirectRead16(&WDC65816::algorithmCMP16);
-    case 0xd3: return MF ? IndirectStackRead8(&WDC65816::algorithmCMP8) : IndirectStackRead16(&WDC65816::algorithmCMP16);
+    case 0xd1: return m ? IndirectIndexedRead8<&WDC65816::algorithmCMP8>() : IndirectIndexedRead16<&WDC65816::algorithmCMP16>();
+    case 0xd2: return m ? IndirectRead8<&WDC65816::algorithmCMP8>() : IndirectRead16<&WDC65816::algorithmCMP16>();
+    case 0xd3: return m ? IndirectStackRead8<&WDC65816::algorithmCMP8>() : IndirectStackRead16<&WDC65816::algorithmCMP16>();
     case 0xd4: return PushEffectiveIndirectAddress();
-    case 0xd5: return MF ? DirectRead8(&WDC65816::algorithmCMP8, X) : DirectRead16(&WDC65816::algorithmCMP16, X);
-    case 0xd6: return MF ? DirectIndexedModify8(&WDC65816::algorithmDEC8) : DirectIndexedModify16(&WDC65816::algorithmDEC16);
-    case 0xd7: return MF ? IndirectLongRead8(&WDC65816::algorithmCMP8, Y) : IndirectLongRead16(&WDC65816::algorithmCMP16, Y);
+    case 0xd5: return m ? DirectRead8<&WDC65816::algorithmCMP8>(X) : DirectRead16<&WDC65816::algorithmCMP16>(X);
+    case 0xd6: return m ? DirectIndexedModify8<&WDC65816::algorithmDEC8>() : DirectIndexedModify16<&WDC65816::algorithmDEC16>();
+    case 0xd7: return m ? IndirectLongRead8<&WDC65816::algorithmCMP8>(Y) : IndirectLongRead16<&WDC65816::algorithmCMP16>(Y);
     case 0xd8: return ClearFlag(DF);
-    case 0xd9: return MF ? BankRead8(&WDC65816::algorithmCMP8, Y) : BankRead16(&WDC65816::algorithmCMP16, Y);
-    case 0xda: return XF ? Push8(X) : Push16(X);
+    case 0xd9: return m ? BankRead8<&WDC65816::algorithmCMP8>(Y) : BankRead16<&WDC65816::algorithmCMP16>(Y);
+    case 0xda: return x ? Push8(X) : Push16(X);
     case 0xdb: return instructionStop();
     case 0xdc: return JumpIndirectLong();
-    case 0xdd: return MF ? BankRead8(&WDC65816::algorithmCMP8, X) : BankRead16(&WDC65816::algorithmCMP16, X);
-    case 0xde: return MF ? BankIndexedModify8(&WDC65816::algorithmDEC8) : BankIndexedModify16(&WDC65816::algorithmDEC16);
-    case 0xdf: return MF ? LongRead8(&WDC65816::algorithmCMP8, X) : LongRead16(&WDC65816::algorithmCMP16, X);
-    case 0xe0: return XF ? ImmediateRead8(&WDC65816::algorithmCPX8) : ImmediateRead16(&WDC65816::algorithmCPX16);
-    case 0xe1: return MF ? IndexedIndirectRead8(&WDC65816::algorithmSBC8) : IndexedIndirectRead16(&WDC65816::algorithmSBC16);
+    case 0xdd: return m ? BankRead8<&WDC65816::algorithmCMP8>(X) : BankRead16<&WDC65816::algorithmCMP16>(X);
+    case 0xde: return m ? BankIndexedModify8<&WDC65816::algorithmDEC8>() : BankIndexedModify16<&WDC65816::algorithmDEC16>();
+    case 0xdf: return m ? LongRead8<&WDC65816::algorithmCMP8>(X) : LongRead16<&WDC65816::algorithmCMP16>(X);
+    case 0xe0: return x ? ImmediateRead8<&WDC65816::algorithmCPX8>() : ImmediateRead16<&WDC65816::algorithmCPX16>();
+    case 0xe1: return m ? IndexedIndirectRead8<&WDC65816::algorithmSBC8>() : IndexedIndirectRead16<&WDC65816::algorithmSBC16>();
     case 0xe2: return SetP();
-    case 0xe3: return MF ? StackRead8(&WDC65816::algorithmSBC8) : StackRead16(&WDC65816::algorithmSBC16);
-    case 0xe4: return XF ? DirectRead8(&WDC65816::algorithmCPX8) : DirectRead16(&WDC65816::algorithmCPX16);
-    case 0xe5: return MF ? DirectRead8(&WDC65816::algorithmSBC8) : DirectRead16(&WDC65816::algorithmSBC16);
-    case 0xe6: return MF ? DirectModify8(&WDC65816::algorithmINC8) : DirectModify16(&WDC65816::algorithmINC16);
-    case 0xe7: return MF ? IndirectLongRead8(&WDC65816::algorithmSBC8) : IndirectLongRead16(&WDC65816::algorithmSBC16);
-    case 0xe8: return XF ? ImpliedModify8(&WDC65816::algorithmINC8, X) : ImpliedModify16(&WDC65816::algorithmINC16, X);
-    case 0xe9: return MF ? ImmediateRead8(&WDC65816::algorithmSBC8) : ImmediateRead16(&WDC65816::algorithmSBC16);
+    case 0xe3: return m ? StackRead8<&WDC65816::algorithmSBC8>() : StackRead16<&WDC65816::algorithmSBC16>();
+    case 0xe4: return x ? DirectRead8<&WDC65816::algorithmCPX8>() : DirectRead16<&WDC65816::algorithmCPX16>();
+    case 0xe5: return m ? DirectRead8<&WDC65816::algorithmSBC8>() : DirectRead16<&WDC65816::algorithmSBC16>();
+    case 0xe6: return m ? DirectModify8<&WDC65816::algorithmINC8>() : DirectModify16<&WDC65816::algorithmINC16>();
+    case 0xe7: return m ? IndirectLongRead8<&WDC65816::algorithmSBC8>() : IndirectLongRead16<&WDC65816::algorithmSBC16>();
+    case 0xe8: return x ? ImpliedModify8<&WDC65816::algorithmINC8>(X) : ImpliedModify16<&WDC65816::algorithmINC16>(X);
+    case 0xe9: return m ? ImmediateRead8<&WDC65816::algorithmSBC8>() : ImmediateRead16<&WDC65816::algorithmSBC16>();
     case 0xea: return NoOperation();
     case 0xeb: return ExchangeBA();
-    case 0xec: return XF ? BankRead8(&WDC65816::algorithmCPX8) : BankRead16(&WDC65816::algorithmCPX16);
-    case 0xed: return MF ? BankRead8(&WDC65816::algorithmSBC8) : BankRead16(&WDC65816::algorithmSBC16);
-    case 0xee: return MF ? BankModify8(&WDC65816::algorithmINC8) : BankModify16(&WDC65816::algorithmINC16);
-    case 0xef: return MF ? LongRead8(&WDC65816::algorithmSBC8) : LongRead16(&WDC65816::algorithmSBC16);
+    case 0xec: return x ? BankRead8<&WDC65816::algorithmCPX8>() : BankRead16<&WDC65816::algorithmCPX16>();
+    case 0xed: return m ? BankRead8<&WDC65816::algorithmSBC8>() : BankRead16<&WDC65816::algorithmSBC16>();
+    case 0xee: return m ? BankModify8<&WDC65816::algorithmINC8>() : BankModify16<&WDC65816::algorithmINC16>();
+    case 0xef: return m ? LongRead8<&WDC65816::algorithmSBC8>() : LongRead16<&WDC65816::algorithmSBC16>();
     case 0xf0: return Branch(ZF == 1);
-    case 0xf1: return MF ? IndirectIndexedRead8(&WDC65816::algorithmSBC8) : IndirectIndexedRead16(&WDC65816::algorithmSBC16);
-    case 0xf2: return MF ? IndirectRead8(&WDC65816::algorithmSBC8) : IndirectRead16(&WDC65816::algorithmSBC16);
-    case 0xf3: return MF ? IndirectStackRead8(&WDC65816::algorithmSBC8) : IndirectStackRead16(&WDC65816::algorithmSBC16);
+    case 0xf1: return m ? IndirectIndexedRead8<&WDC65816::algorithmSBC8>() : IndirectIndexedRead16<&WDC65816::algorithmSBC16>();
+    case 0xf2: return m ? IndirectRead8<&WDC65816::algorithmSBC8>() : IndirectRead16<&WDC65816::algorithmSBC16>();
+    case 0xf3: return m ? IndirectStackRead8<&WDC65816::algorithmSBC8>() : IndirectStackRead16<&WDC65816::algorithmSBC16>();
     case 0xf4: return PushEffectiveAddress();
-    case 0xf5: return MF ? DirectRead8(&WDC65816::algorithmSBC8, X) : DirectRead16(&WDC65816::algorithmSBC16, X);
-    case 0xf6: return MF ? DirectIndexedModify8(&WDC65816::algorithmINC8) : DirectIndexedModify16(&WDC65816::algorithmINC16);
-    case 0xf7: return MF ? IndirectLongRead8(&WDC65816::algorithmSBC8, Y) : IndirectLongRead16(&WDC65816::algorithmSBC16, Y);
+    case 0xf5: return m ? DirectRead8<&WDC65816::algorithmSBC8>(X) : DirectRead16<&WDC65816::algorithmSBC16>(X);
+    case 0xf6: return m ? DirectIndexedModify8<&WDC65816::algorithmINC8>() : DirectIndexedModify16<&WDC65816::algorithmINC16>();
+    case 0xf7: return m ? IndirectLongRead8<&WDC65816::algorithmSBC8>(Y) : IndirectLongRead16<&WDC65816::algorithmSBC16>(Y);
     case 0xf8: return SetFlag(DF);
-    case 0xf9: return MF ? BankRead8(&WDC65816::algorithmSBC8, Y) : BankRead16(&WDC65816::algorithmSBC16, Y);
-    case 0xfa: return XF ? Pull8(X) : Pull16(X);
+    case 0xf9: return m ? BankRead8<&WDC65816::algorithmSBC8>(Y) : BankRead16<&WDC65816::algorithmSBC16>(Y);
+    case 0xfa: return x ? Pull8(X) : Pull16(X);
     case 0xfb: return ExchangeCE();
     case 0xfc: return CallIndexedIndirect();
-    case 0xfd: return MF ? BankRead8(&WDC65816::algorithmSBC8, X) : BankRead16(&WDC65816::algorithmSBC16, X);
-    case 0xfe: return MF ? BankIndexedModify8(&WDC65816::algorithmINC8) : BankIndexedModify16(&WDC65816::algorithmINC16);
-    case 0xff: return MF ? LongRead8(&WDC65816::algorithmSBC8, X) : LongRead16(&WDC65816::algorithmSBC16, X);
+    case 0xfd: return m ? BankRead8<&WDC65816::algorithmSBC8>(X) : BankRead16<&WDC65816::algorithmSBC16>(X);
+    case 0xfe: return m ? BankIndexedModify8<&WDC65816::algorithmINC8>() : BankIndexedModify16<&WDC65816::algorithmINC16>();
+    case 0xff: return m ? LongRead8<&WDC65816::algorithmSBC8>(X) : LongRead16<&WDC65816::algorithmSBC16>(X);
   }
 }
 
+void WDC65816::instruction() {
+  if(MF) return XF ? instruction<1, 1>() : instruction<1, 0>();
+  return XF ? instruction<0, 1>() : instruction<0, 0>();
+}
+
 void WDC65816::power() {
   r.pc.d = 0x000000;
   r.a  = 0x0000;
@@ -128,30 +128,30 @@ struct WDC65816 {
   uint8_t algorithmTSB8(uint8_t);
   uint16_t algorithmTSB16(uint16_t);
 
-  void ImmediateRead8(alu8);
-  void ImmediateRead16(alu16);
-  void BankRead8(alu8);
-  void BankRead16(alu16);
-  void BankRead8(alu8, r16);
-  void BankRead16(alu16, r16);
-  void LongRead8(alu8, r16 = {});
-  void LongRead16(alu16, r16 = {});
-  void DirectRead8(alu8);
-  void DirectRead16(alu16);
-  void DirectRead8(alu8, r16);
-  void DirectRead16(alu16, r16);
-  void IndirectRead8(alu8);
-  void IndirectRead16(alu16);
-  void IndexedIndirectRead8(alu8);
-  void IndexedIndirectRead16(alu16);
-  void IndirectIndexedRead8(alu8);
-  void IndirectIndexedRead16(alu16);
-  void IndirectLongRead8(alu8, r16 = {});
-  void IndirectLongRead16(alu16, r16 = {});
-  void StackRead8(alu8);
-  void StackRead16(alu16);
-  void IndirectStackRead8(alu8);
-  void IndirectStackRead16(alu16);
+  template<alu8> void ImmediateRead8();
+  template<alu16> void ImmediateRead16();
+  template<alu8> void BankRead8();
+  template<alu16> void BankRead16();
+  template<alu8> void BankRead8(r16);
+  template<alu16> void BankRead16(r16);
+  template<alu8> void LongRead8(r16 = {});
+  template<alu16> void LongRead16(r16 = {});
+  template<alu8> void DirectRead8();
+  template<alu16> void DirectRead16();
+  template<alu8> void DirectRead8(r16);
+  template<alu16> void DirectRead16(r16);
+  template<alu8> void IndirectRead8();
+  template<alu16> void IndirectRead16();
+  template<alu8> void IndexedIndirectRead8();
+  template<alu16> void IndexedIndirectRead16();
+  template<alu8> void IndirectIndexedRead8();
+  template<alu16> void IndirectIndexedRead16();
+  template<alu8> void IndirectLongRead8(r16 = {});
+  template<alu16> void IndirectLongRead16(r16 = {});
+  template<alu8> void StackRead8();
+  template<alu16> void StackRead16();
+  template<alu8> void IndirectStackRead8();
+  template<alu16> void IndirectStackRead16();
 
   void BankWrite8(r16);
   void BankWrite16(r16);
@@ -176,16 +176,16 @@ struct WDC65816 {
   void IndirectStackWrite8();
   void IndirectStackWrite16();
 
-  void ImpliedModify8(alu8, r16&);
-  void ImpliedModify16(alu16, r16&);
-  void BankModify8(alu8);
-  void BankModify16(alu16);
-  void BankIndexedModify8(alu8);
-  void BankIndexedModify16(alu16);
-  void DirectModify8(alu8);
-  void DirectModify16(alu16);
-  void DirectIndexedModify8(alu8);
-  void DirectIndexedModify16(alu16);
+  template<alu8> void ImpliedModify8(r16&);
+  template<alu16> void ImpliedModify16(r16&);
+  template<alu8> void BankModify8();
+  template<alu16> void BankModify16();
+  template<alu8> void BankIndexedModify8();
+  template<alu16> void BankIndexedModify16();
+  template<alu8> void DirectModify8();
+  template<alu16> void DirectModify16();
+  template<alu8> void DirectIndexedModify8();
+  template<alu16> void DirectIndexedModify16();
 
   void Branch(bool = 1);
   void BranchLong();
@@ -235,6 +235,7 @@ struct WDC65816 {
   void PushEffectiveRelativeAddress();
 
   void instruction();
+  template<bool, bool> void instruction();
 
   void serialize(serializer&);
 
@@ -28,11 +28,11 @@
 
 namespace SuperFamicom {
 
-Random random;
+SFC_LOCAL Random random;
 
-static Random::Entropy _entropy = Random::Entropy::High;
-static uint64_t _state;
-static uint64_t _increment;
+static SFC_LOCAL Random::Entropy _entropy = Random::Entropy::High;
+static SFC_LOCAL uint64_t _state;
+static SFC_LOCAL uint64_t _increment;
 
 static uint32_t step() {
   uint64_t state = _state;
@@ -42,8 +42,8 @@ static uint32_t step() {
   return xorshift >> rotate | xorshift << (-rotate & 31);
 }
 
-static void seed() {
-  uint32_t seed = (uint32_t)clock();
+static void seed(uint32_t seed) {
+  if(!seed) seed = (uint32_t)clock();
   uint32_t sequence = 0;
 
   _state = 0;
@@ -57,9 +57,9 @@ uint64_t Random::operator()() {
   return random();
 }
 
-void Random::entropy(Random::Entropy entropy) {
+void Random::entropy(Random::Entropy entropy, uint32_t value) {
   _entropy = entropy;
-  seed();
+  seed(value);
 }
 
 uint64_t Random::random() {
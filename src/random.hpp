@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct Random {
@@ -32,10 +34,10 @@ struct Random {
   uint64_t bound(uint64_t);
 
   void array(uint8_t*, uint32_t);
-  void entropy(Entropy);
+  void entropy(Entropy, uint32_t = 0);
   void serialize(serializer&);
 };
 
-extern Random random;
+extern SFC_LOCAL Random random;
 
 }
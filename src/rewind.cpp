@@ -0,0 +1,182 @@
+/*
+ * bsnes-jg - Super Nintendo emulator
+ *
+ * Copyright (C) 2004-2020 byuu
+ * Copyright (C) 2020-2022 Rupert Carmichael
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, specifically version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "serializer.hpp"
+#include "system.hpp"
+
+#include "rewind.hpp"
+
+namespace SuperFamicom {
+
+SFC_LOCAL Rewind rewinder;
+
+constexpr unsigned Rewind::Granularity;
+
+void Rewind::reset(size_t capacity) {
+  ring.clear();
+  ring.shrink_to_fit();
+  ring.resize(capacity);
+  clear();
+}
+
+void Rewind::clear() {
+  head = tail = fill = 0;
+  count = 0;
+  state.clear();
+}
+
+bool Rewind::push() {
+  if(ring.empty()) return false;
+
+  serializer s = system.serialize(false);
+  const uint8_t *data = s.data();
+  unsigned size = s.size();
+  if(!size) return false;
+
+  //the first state, or one from different content, starts a new history
+  if(state.size() != size) {
+    clear();
+    state.assign(data, data + size);
+    return true;
+  }
+
+  entry.resize(4 + size + 8 * (size / Granularity + 1) + 4);
+  size_t pos = 4;
+  auto store = [&](uint32_t value) {
+    for(unsigned n = 0; n < 4; ++n) entry[pos++] = value >> (n << 3);
+  };
+
+  unsigned offset = 0;
+  unsigned last = 0;
+  while(offset < size) {
+    unsigned length = std::min(Granularity, size - offset);
+    if(!std::memcmp(data + offset, &state[offset], length)) {
+      offset += length;
+      continue;
+    }
+
+    unsigned start = offset;
+    while(offset < size) {
+      length = std::min(Granularity, size - offset);
+      if(!std::memcmp(data + offset, &state[offset], length)) break;
+      offset += length;
+    }
+
+    store(start - last);
+    store(offset - start);
+    for(unsigned n = start; n < offset; ++n) {
+      entry[pos++] = state[n] ^ data[n];
+      state[n] = data[n];
+    }
+    last = offset;
+  }
+
+  //entries are framed by their length on both sides, so the ring can be
+  //walked from the oldest end when dropping and from the newest when stepping
+  uint32_t length = pos - 4;
+  store(length);
+  pos = 0;
+  store(length);
+  pos = length + 8;
+
+  if(pos > ring.size()) {
+    clear();
+    state.assign(data, data + size);
+    return false;
+  }
+
+  while(ring.size() - fill < pos) {
+    uint8_t framing[4];
+    get(framing, tail, 4);
+    size_t dropped = 8 + (framing[0] | framing[1] << 8 | framing[2] << 16 | (size_t)framing[3] << 24);
+    tail = (tail + dropped) % ring.size();
+    fill -= dropped;
+    --count;
+  }
+
+  put(entry.data(), pos);
+  ++count;
+  return true;
+}
+
+bool Rewind::step() {
+  if(!count) return false;
+
+  uint8_t framing[4];
+  get(framing, (head + ring.size() - 4) % ring.size(), 4);
+  size_t length = framing[0] | framing[1] << 8 | framing[2] << 16 | (size_t)framing[3] << 24;
+  size_t start = (head + ring.size() - 8 - length) % ring.size();
+
+  entry.resize(length);
+  get(entry.data(), (start + 4) % ring.size(), length);
+  head = start;
+  fill -= length + 8;
+  --count;
+
+  size_t pos = 0;
+  auto load = [&]() -> uint32_t {
+    uint32_t value = 0;
+    for(unsigned n = 0; n < 4; ++n) value |= (uint32_t)entry[pos++] << (n << 3);
+    return value;
+  };
+
+  unsigned offset = 0;
+  while(pos < length) {
+    offset += load();
+    unsigned run = load();
+    for(unsigned n = 0; n < run; ++n) state[offset++] ^= entry[pos++];
+  }
+
+  serializer s(state.data(), state.size());
+  return system.unserialize(s);
+}
+
+unsigned Rewind::frames() const {
+  return count;
+}
+
+size_t Rewind::used() const {
+  return ring.empty() ? 0 : fill + state.size();
+}
+
+double Rewind::perFrame() const {
+  return count ? (double)fill / count : 0.0;
+}
+
+//internal
+
+void Rewind::put(const uint8_t *data, size_t size) {
+  size_t first = std::min(size, ring.size() - head);
+  std::memcpy(&ring[head], data, first);
+  std::memcpy(&ring[0], data + first, size - first);
+  head = (head + size) % ring.size();
+  fill += size;
+}
+
+void Rewind::get(uint8_t *data, size_t offset, size_t size) const {
+  size_t first = std::min(size, ring.size() - offset);
+  std::memcpy(data, &ring[offset], first);
+  std::memcpy(data + first, &ring[0], size - first);
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * bsnes-jg - Super Nintendo emulator
+ *
+ * Copyright (C) 2004-2020 byuu
+ * Copyright (C) 2020-2022 Rupert Carmichael
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, specifically version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "instance.hpp"
+
+namespace SuperFamicom {
+
+//rewind history: only the newest state is kept in full. Each push stores the
+//XOR of the previous state and the new one in a fixed size ring, and stepping
+//back XORs the newest entry into the full state to recover the one before it.
+//When the ring is full the oldest entries are dropped to make room.
+struct Rewind {
+  void reset(size_t);
+  void clear();
+  bool push();
+  bool step();
+
+  unsigned frames() const;
+  size_t used() const;
+  double perFrame() const;
+
+private:
+  //entries store runs of differing bytes as skip, length and XOR data, with
+  //runs found at Granularity byte resolution
+  static constexpr unsigned Granularity = 32;
+
+  void put(const uint8_t*, size_t);
+  void get(uint8_t*, size_t, size_t) const;
+
+  std::vector<uint8_t> ring;
+  size_t head = 0;  //end of the newest entry
+  size_t tail = 0;  //start of the oldest entry
+  size_t fill = 0;
+  unsigned count = 0;
+
+  std::vector<uint8_t> state;  //newest state in full
+  std::vector<uint8_t> entry;
+};
+
+extern SFC_LOCAL Rewind rewinder;
+
+}
@@ -72,3 +72,15 @@ void serializer::setMode(Mode mode) {
   _mode = mode;
   _size = 0;
 }
+
+//prepare to save a state of the given size, reusing the existing buffer when
+//it is already that size
+void serializer::reserve(unsigned capacity) {
+  if(_capacity != capacity) {
+    if(_data) delete[] _data;
+    _data = new uint8_t[capacity]();
+    _capacity = capacity;
+  }
+  _mode = serializer::Save;
+  _size = 0;
+}
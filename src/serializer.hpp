@@ -32,8 +32,12 @@
 //- floating-point usage is not portable across different implementations
 
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include <utility>
 
+#include "processor/endian.hpp"
+
 struct serializer;
 
 template<typename T>
@@ -51,6 +55,7 @@ struct serializer {
   unsigned size() const;
 
   void setMode(Mode);
+  void reserve(unsigned);
 
   template<typename T> serializer& boolean(T& value) {
     if(_mode == Save) {
@@ -78,8 +83,7 @@ struct serializer {
   }
 
   template<typename T, int N> serializer& array(T (&_array)[N]) {
-    for(unsigned n = 0; n < N; ++n) operator()(_array[n]);
-    return *this;
+    return array(&_array[0], N);
   }
 
   template<typename T> serializer& array(T _array, unsigned size) {
@@ -89,8 +93,20 @@ struct serializer {
 
   //optimized specializations
 
-  template<int N> serializer& array(uint8_t (&data)[N]) {
-    return array(data, N);
+  //integer arrays are stored as a single little-endian block, which matches
+  //integer() element by element while avoiding its per-byte loop
+  template<typename T> serializer& array(T* _array, unsigned size,
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<bool, T>::value>::type* = 0) {
+    unsigned length = size * sizeof(T);
+    if(_mode == Save) {
+      std::memcpy(_data + _size, _array, length);
+      if(!ENDIAN_LSB) swap<sizeof(T)>(_data + _size, size);
+    } else if(_mode == Load) {
+      std::memcpy(_array, _data + _size, length);
+      if(!ENDIAN_LSB) swap<sizeof(T)>((uint8_t*)_array, size);
+    }
+    _size += length;
+    return *this;
   }
 
   template<typename T> serializer& operator()(T& value, typename std::enable_if<has_serialize<T>::value>::type* = 0) {
@@ -110,6 +126,12 @@ struct serializer {
   ~serializer();
 
 private:
+  template<unsigned W> static void swap(uint8_t* data, unsigned size) {
+    for(unsigned n = 0; n < size; ++n, data += W) {
+      for(unsigned lo = 0, hi = W - 1; lo < hi; ++lo, --hi) std::swap(data[lo], data[hi]);
+    }
+  }
+
   Mode _mode = Size;
   uint8_t* _data = nullptr;
   unsigned _size = 0;
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct ID {
@@ -70,17 +72,22 @@ struct Configuration {
 
   bool hotfixes = false;
   unsigned entropy = 1; // 0 = None, 1 = Low, 2 = High
+  unsigned seed = 0; // 0 = seed from the host clock
 
   struct Coprocessor {
     bool delayedSync = true;
     bool preferHLE = false;
   } coprocessor;
 
+  struct Video {
+    bool skipRender = false;
+  } video;
+
   unsigned controllerPort1 = ID::Device::Gamepad;
   unsigned controllerPort2 = ID::Device::Gamepad;
   unsigned expansionPort = ID::Device::None;
 };
 
-extern Configuration configuration;
+extern SFC_LOCAL Configuration configuration;
 
 }
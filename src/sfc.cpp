@@ -18,6 +18,7 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
 #include <cstring>
 
 #include "sfc.hpp"
@@ -26,20 +27,117 @@ namespace SuperFamicom {
 
 void Scheduler::enter() {
   host = co_active();
+#if defined(BSNES_STATS)
+  if(mode == Mode::Synchronize) ++stats.runToSave;
+  stats.switched(host, active);
+#endif
   co_switch(active);
 }
 
 void Scheduler::leave(Event event_) {
   event = event_;
   active = co_active();
+#if defined(BSNES_STATS)
+  stats.switched(active, host);
+#endif
   co_switch(host);
 }
 
 void Scheduler::resume(cothread_t thread) {
   if(mode == Mode::Synchronize) desynchronized = true;
+#if defined(BSNES_STATS)
+  stats.switched(co_active(), thread);
+#endif
   co_switch(thread);
 }
 
+#if defined(BSNES_STATS)
+uint64_t Statistics::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Statistics::reset() {
+  for(unsigned n = 0; n < Threads; ++n) {
+    entries[n].start = entries[n].timer ? entries[n].timer->clock : 0;
+    entries[n].slices = 0;
+    entries[n].elapsed = 0;
+    entries[n].nanoseconds = 0;
+    entries[n].frameStart = 0;
+    for(unsigned m = 0; m < Threads; ++m) switches[n][m] = 0;
+  }
+  for(uint64_t& bucket : histogram) bucket = 0;
+  total = frameStart = frames = runToSave = 0;
+  mark = frameMark = now();
+}
+
+//threads past the table's capacity are counted together as Other
+unsigned Statistics::add(cothread_t thread, const char *name, const Thread *timer, bool invert, bool scaled) {
+  if(count >= Other) return Other;
+  Entry& entry = entries[count];
+  entry = {};
+  entry.thread = thread;
+  entry.name = name;
+  entry.timer = timer;
+  entry.invert = invert;
+  entry.scaled = scaled;
+  return count++;
+}
+
+unsigned Statistics::find(cothread_t thread) const {
+  for(unsigned n = 0; n < count; ++n) {
+    if(entries[n].thread == thread) return n;
+  }
+  return Other;
+}
+
+void Statistics::switched(cothread_t from, cothread_t to) {
+  Entry& source = entries[find(from)];
+  Entry& target = entries[find(to)];
+  ++switches[&source - entries][&target - entries];
+  ++total;
+
+  uint64_t time = now();
+  source.nanoseconds += time - mark;
+  mark = time;
+
+  if(source.timer) {
+    int64_t clock = source.timer->clock;
+    source.elapsed += source.invert ? source.start - clock : clock - source.start;
+  }
+  ++target.slices;
+  if(target.timer) target.start = target.timer->clock;
+}
+
+void Statistics::frame() {
+  uint64_t bucket = (total - frameStart) / BucketSize;
+  ++histogram[bucket < Buckets ? bucket : Buckets - 1];
+  frameStart = total;
+
+  uint64_t time = now();
+  entries[find(co_active())].nanoseconds += time - mark;
+  mark = time;
+
+  uint32_t *record = frameTimes[frames % Window];
+  for(unsigned n = 0; n < Threads; ++n) {
+    record[n] = entries[n].nanoseconds - entries[n].frameStart;
+    entries[n].frameStart = entries[n].nanoseconds;
+  }
+  record[Threads] = time - frameMark;
+  frameMark = time;
+  ++frames;
+}
+
+//elapsed time in master clocks: scaled clocks count master clocks times the
+//thread's own frequency
+uint64_t Statistics::clocks(unsigned n) const {
+  const Entry& entry = entries[n];
+  if(!entry.timer || entry.elapsed < 0) return 0;
+  if(entry.scaled && entry.timer->frequency) return entry.elapsed / entry.timer->frequency;
+  return entry.elapsed;
+}
+#endif
+
 void Thread::create(void (*entrypoint)(), unsigned frequency_) {
   if(!thread) {
     thread = co_create(Thread::Size, entrypoint);
@@ -65,7 +163,7 @@ void Thread::serialize(serializer& s) {
 }
 
 void Thread::serializeStack(serializer& s) {
-  static uint8_t stack[Thread::Size];
+  static SFC_LOCAL uint8_t stack[Thread::Size];
   bool active = co_active() == thread;
 
   if(s.mode() == serializer::Size) {
@@ -22,6 +22,7 @@
 
 #include <libco/libco.h>
 
+#include "instance.hpp"
 #include "serializer.hpp"
 
 inline constexpr unsigned long long operator"" _KiB(unsigned long long value) {
@@ -30,6 +31,57 @@ inline constexpr unsigned long long operator"" _KiB(unsigned long long value) {
 
 namespace SuperFamicom {
 
+struct Thread;
+
+#if defined(BSNES_STATS)
+//context switch, timeslice and host time counters, reported by Bsnes::getStats
+struct Statistics {
+  enum : unsigned {
+    Threads = 12, Other = Threads - 1, Buckets = 16, BucketSize = 256, Window = 256
+  };
+
+  //a thread's progress is read from a Thread clock: the CPU's own clock is
+  //never advanced, so its slices are measured by how far the PPU falls behind
+  struct Entry {
+    cothread_t thread = nullptr;
+    const char *name = "Other";
+    const Thread *timer = nullptr;
+    bool invert = false;
+    bool scaled = false;
+    int64_t start = 0;
+    uint64_t slices = 0;
+    int64_t elapsed = 0;
+    uint64_t nanoseconds = 0;
+    uint64_t frameStart = 0;
+  };
+
+  static uint64_t now();
+
+  void reset();
+  unsigned add(cothread_t, const char*, const Thread*, bool, bool);
+  unsigned find(cothread_t) const;
+  void switched(cothread_t, cothread_t);
+  void frame();
+  uint64_t clocks(unsigned) const;
+
+  Entry entries[Threads];
+  unsigned count = 0;
+  uint64_t switches[Threads][Threads] = {};
+  uint64_t histogram[Buckets] = {};
+  uint64_t total = 0;
+  uint64_t frameStart = 0;
+  uint64_t frames = 0;
+  uint64_t runToSave = 0;
+
+  //host time is charged to the running thread at each switch, starting from
+  //mark. The last Window frames are kept for rolling percentiles, with the
+  //whole frame's time in the last column
+  uint64_t mark = 0;
+  uint64_t frameMark = 0;
+  uint32_t frameTimes[Window][Threads + 1] = {};
+};
+#endif
+
 struct Scheduler {
   enum class Mode : unsigned { Run, Synchronize } mode;
   enum class Event : unsigned { Frame, Synchronized, Desynchronized } event;
@@ -37,6 +89,9 @@ struct Scheduler {
   cothread_t host = nullptr;
   cothread_t active = nullptr;
   bool desynchronized = false;
+#if defined(BSNES_STATS)
+  Statistics stats;
+#endif
 
   void enter();
   void leave(Event);
@@ -47,7 +102,7 @@ struct Scheduler {
   inline void desynchronize();
 };
 
-extern Scheduler scheduler;
+extern SFC_LOCAL Scheduler scheduler;
 
 struct Thread {
   enum : unsigned { Size = 4_KiB * sizeof(void*) };
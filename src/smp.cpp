@@ -29,7 +29,7 @@
 
 namespace SuperFamicom {
 
-SMP smp;
+SFC_LOCAL SMP smp;
 
 const uint8_t SMP::iplrom[64] = {
   /*ffc0*/  0xcd, 0xef,        //mov   x,#$ef
@@ -451,7 +451,7 @@ void SMP::synchronizeCPU() {
 }
 
 void SMP::synchronizeDSP() {
-  while(dsp.clock < 0) dsp.main();
+  if(dsp.clock < 0) dsp.main();
 }
 
 [[noreturn]] static void Enter() {
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "instance.hpp"
 #include "processor/spc700.hpp"
 
 namespace SuperFamicom {
@@ -118,6 +119,6 @@ private:
   inline void stepTimers(unsigned);
 };
 
-extern SMP smp;
+extern SFC_LOCAL SMP smp;
 
 }
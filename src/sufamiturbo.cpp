@@ -29,8 +29,8 @@ void SufamiTurboCartridge::serialize(serializer& s) {
   s.array(ram.data(), ram.size());
 }
 
-SufamiTurboCartridge sufamiturboA;
-SufamiTurboCartridge sufamiturboB;
+SFC_LOCAL SufamiTurboCartridge sufamiturboA;
+SFC_LOCAL SufamiTurboCartridge sufamiturboB;
 
 void SufamiTurboCartridge::unload() {
   rom.reset();
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 struct SufamiTurboCartridge {
@@ -32,7 +34,7 @@ struct SufamiTurboCartridge {
   WritableMemory ram;
 };
 
-extern SufamiTurboCartridge sufamiturboA;
-extern SufamiTurboCartridge sufamiturboB;
+extern SFC_LOCAL SufamiTurboCartridge sufamiturboA;
+extern SFC_LOCAL SufamiTurboCartridge sufamiturboB;
 
 }
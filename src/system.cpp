@@ -18,7 +18,10 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cstring>
+#include <utility>
+#include <vector>
 
 #include "audio.hpp"
 #include "cartridge.hpp"
@@ -56,14 +59,23 @@
 
 namespace SuperFamicom {
 
-System system;
-Scheduler scheduler;
+SFC_LOCAL System system;
+SFC_LOCAL Scheduler scheduler;
+
+constexpr unsigned System::DeltaSignature;
+constexpr unsigned System::DeltaBlock;
 
 serializer System::serialize(bool synchronize) {
+  serializer s;
+  serialize(s, synchronize);
+  return s;
+}
+
+bool System::serialize(serializer& s, bool synchronize) {
   //deterministic serialization (synchronize=false) is only possible with select libco methods
   if(!co_serializable()) synchronize = true;
 
-  if(!information.serializeSize[synchronize]) return {};  //should never occur
+  if(!information.serializeSize[synchronize]) return false;  //should never occur
   if(synchronize) runToSave();
 
   unsigned signature = 0x31545342;
@@ -73,7 +85,7 @@ serializer System::serialize(bool synchronize) {
   bool placeholder = false;
   std::memcpy(&version, (const char*)SerializerVersion.c_str(), SerializerVersion.size());
 
-  serializer s(serializeSize);
+  s.reserve(serializeSize);
   s.integer(signature);
   s.integer(serializeSize);
   s.array(version);
@@ -81,7 +93,7 @@ serializer System::serialize(bool synchronize) {
   s.boolean(synchronize);
   s.boolean(placeholder);
   serializeAll(s, synchronize);
-  return s;
+  return true;
 }
 
 bool System::unserialize(serializer& s) {
@@ -113,6 +125,78 @@ unsigned System::serializeSize(bool synchronize) {
   return information.serializeSize[synchronize];
 }
 
+unsigned System::serializeDeltaSize() {
+  unsigned size = information.serializeSize[true];
+  return 8 + size + 8 * (size / DeltaBlock + 1);
+}
+
+unsigned System::serializeDelta(const uint8_t *base, unsigned baseSize, uint8_t *data) {
+  if(baseSize != information.serializeSize[true]) return 0;
+  serializer s = serialize(true);
+  const uint8_t *state = s.data();
+  unsigned size = s.size();
+  if(!size || size != baseSize) return 0;
+
+  unsigned pos = 0;
+  auto put = [&](uint32_t value) {
+    for(unsigned n = 0; n < 4; ++n) data[pos++] = value >> (n << 3);
+  };
+
+  put(DeltaSignature);
+  put(size);
+
+  unsigned offset = 0;
+  while(offset < size) {
+    if(!std::memcmp(state + offset, base + offset, std::min(DeltaBlock, size - offset))) {
+      offset += DeltaBlock;
+      continue;
+    }
+
+    unsigned start = offset;
+    do {
+      offset += DeltaBlock;
+    } while(offset < size
+      && std::memcmp(state + offset, base + offset, std::min(DeltaBlock, size - offset)));
+    offset = std::min(offset, size);
+
+    put(start);
+    put(offset - start);
+    std::memcpy(data + pos, state + start, offset - start);
+    pos += offset - start;
+  }
+
+  return pos;
+}
+
+bool System::unserializeDelta(const uint8_t *base, unsigned baseSize, const uint8_t *data, unsigned size) {
+  if(baseSize != information.serializeSize[true]) return false;
+
+  unsigned pos = 0;
+  auto get = [&]() -> uint32_t {
+    uint32_t value = 0;
+    for(unsigned n = 0; n < 4; ++n) value |= (uint32_t)data[pos++] << (n << 3);
+    return value;
+  };
+
+  if(size < 8 || get() != DeltaSignature) return false;
+  unsigned stateSize = get();
+  if(stateSize != information.serializeSize[true]) return false;
+
+  std::vector<uint8_t> state(base, base + stateSize);
+  while(pos + 8 <= size) {
+    unsigned offset = get();
+    unsigned length = get();
+    if(offset > stateSize || length > stateSize - offset || length > size - pos)
+      return false;
+    std::memcpy(state.data() + offset, data + pos, length);
+    pos += length;
+  }
+  if(pos != size) return false;
+
+  serializer s(state.data(), stateSize);
+  return unserialize(s);
+}
+
 //internal
 
 void System::serializeAll(serializer& s, bool synchronize) {
@@ -275,6 +359,9 @@ void System::runToSaveSpecial() {
 
 
 void System::frameEvent() {
+#if defined(BSNES_STATS)
+  scheduler.stats.frame();
+#endif
   ppu.refresh();
 
   //refresh all cheat codes once per frame
@@ -381,7 +468,7 @@ void System::unload() {
 void System::power(bool reset) {
   audio.reset();
 
-  random.entropy((Random::Entropy)configuration.entropy);
+  random.entropy((Random::Entropy)configuration.entropy, configuration.seed);
 
   cpu.power(reset);
   smp.power();
@@ -427,6 +514,29 @@ void System::power(bool reset) {
 
   scheduler.active = cpu.thread;
 
+#if defined(BSNES_STATS)
+  scheduler.stats = {};
+  scheduler.stats.add(co_active(), "Host", nullptr, false, false);
+  scheduler.stats.add(cpu.thread, "CPU", &ppu, true, false);
+  scheduler.stats.add(smp.thread, "SMP", &smp, false, true);
+  scheduler.stats.add(ppu.thread, "PPU", &ppu, false, false);
+
+  const std::pair<Thread*, const char*> names[] = {
+    {&icd, "ICD"}, {&event, "Event"}, {&sa1, "SA-1"}, {&superfx, "SuperFX"},
+    {&armdsp, "ARM DSP"}, {&hitachidsp, "Hitachi DSP"}, {&necdsp, "NEC DSP"},
+    {&epsonrtc, "Epson RTC"}, {&sharprtc, "Sharp RTC"}, {&spc7110, "SPC7110"},
+    {&msu1, "MSU-1"}, {&bsmemory, "BS Memory"}
+  };
+  for(Thread* coprocessor : cpu.coprocessors) {
+    for(const std::pair<Thread*, const char*>& name : names) {
+      if(name.first == coprocessor) {
+        scheduler.stats.add(coprocessor->thread, name.second, coprocessor, false, true);
+      }
+    }
+  }
+  scheduler.stats.reset();
+#endif
+
   controllerPort1.power(ID::Port::Controller1);
   controllerPort2.power(ID::Port::Controller2);
 
@@ -20,6 +20,10 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include "instance.hpp"
+
 namespace SuperFamicom {
 
 static constexpr double FREQ_NTSC = 315.0 / 88.0 * 1000000.0;
@@ -51,7 +55,11 @@ struct System {
 
   unsigned serializeSize(bool);
   serializer serialize(bool);
+  bool serialize(serializer&, bool);
   bool unserialize(serializer&);
+  unsigned serializeDeltaSize();
+  unsigned serializeDelta(const uint8_t*, unsigned, uint8_t*);
+  bool unserializeDelta(const uint8_t*, unsigned, const uint8_t*, unsigned);
 
   bool runAhead = false;
 
@@ -64,13 +72,18 @@ private:
     unsigned serializeSize[2] = {0, 0};
   } information;
 
+  //delta states hold the runs of DeltaBlock sized blocks which differ from a
+  //full base state, each stored as offset, length and the new bytes
+  static constexpr unsigned DeltaSignature = 0x44545342;
+  static constexpr unsigned DeltaBlock = 64;
+
   void serializeAll(serializer&, bool);
   unsigned serializeInit(bool);
 
   bool states_special = false;
 };
 
-extern System system;
+extern SFC_LOCAL System system;
 
 bool System::loaded() const {
   return information.loaded;